@@ -22,57 +22,316 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "../include/thames.h"
 
+std::string state_filepath(const std::string& filepathout, const std::size_t index) {
+    // Replace extension of the output file with the index of the output time
+    std::filesystem::path filepath(filepathout);
+    filepath.replace_extension("");
+    return filepath.string() + "_states_" + std::to_string(index) + ".npy";
+}
+
+template<class T>
+std::string precision_name() {
+    // Return the name of the numeric type, as used by the precision parameter
+    if constexpr (std::is_same<T, float>::value) {
+        return "Float";
+    } else if constexpr (std::is_same<T, long double>::value) {
+        return "LongDouble";
+    } else {
+        return "Double";
+    }
+}
+
+// Cache of perturbation objects shared between runs, keyed by their type and the settings on which they depend
+struct PerturbationCache {
+    /// Mutex guarding the cache
+    std::mutex mutex;
+
+    /// Perturbation objects
+    std::map<std::string, std::shared_ptr<const void>> perturbations;
+};
+
+template<class C, class T, class F>
+std::shared_ptr<const C> shared_perturbation(const thames::settings::Parameters<T>& parameters, PerturbationCache* cache, F create) {
+    // Create perturbation directly if not cached
+    if (cache == nullptr)
+        return create();
+
+    // Generate key from the type and settings of the perturbation
+    const nlohmann::json settings = {parameters.perturbation, parameters.spacecraft};
+    const std::string key = std::string(typeid(C).name()) + settings.dump();
+
+    // Retrieve perturbation, creating it on first use
+    // NOTE: perturbation objects are immutable after construction, so they may be shared between concurrent runs
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    std::shared_ptr<const void>& perturbation = cache->perturbations[key];
+    if (!perturbation)
+        perturbation = create();
+    return std::static_pointer_cast<const C>(perturbation);
+}
+
+template<class T>
+std::vector<std::vector<T>> input_states(const thames::settings::StateParameters<T>& state) {
+    // Return state vectors if sampling is disabled
+    const thames::settings::SamplingParameters<T>& sampling = state.sampling;
+    if (sampling.method.empty())
+        return state.states;
+
+    // Import sampling method
+    thames::util::sampling::SamplingMethods method;
+    if (sampling.method == "LHS") {
+        method = thames::util::sampling::LATIN_HYPERCUBE;
+    } else if (sampling.method == "Sobol") {
+        method = thames::util::sampling::SOBOL;
+    } else if (sampling.method == "Halton") {
+        method = thames::util::sampling::HALTON;
+    } else {
+        throw std::runtime_error("Unsupported sampling method requested");
+    }
+
+    // Generate samples about the mean state
+    const std::vector<T>& mean = state.states[0];
+    std::vector<T> lower(mean.size()), upper(mean.size());
+    for (std::size_t ii=0; ii<mean.size(); ii++) {
+        lower[ii] = mean[ii] + sampling.lowerBound[ii];
+        upper[ii] = mean[ii] + sampling.upperBound[ii];
+    }
+    const std::vector<T> samples = thames::util::sampling::generate_samples(method, sampling.count, lower, upper, sampling.seed, sampling.threads);
+
+    // Split samples into state vectors
+    std::vector<std::vector<T>> states(sampling.count);
+    for (std::size_t ii=0; ii<sampling.count; ii++)
+        states[ii].assign(samples.begin() + mean.size()*ii, samples.begin() + mean.size()*(ii + 1));
+    return states;
+}
+
+template<class T>
+thames::util::sampling::CartesianGrid<T> input_grid(const thames::settings::StateParameters<T>& state) {
+    // Generate evenly spaced points in each state variable about the mean state
+    const thames::settings::SamplingParameters<T>& sampling = state.sampling;
+    const std::vector<T>& mean = state.states[0];
+    std::vector<std::vector<T>> points(mean.size());
+    for (std::size_t ii=0; ii<mean.size(); ii++)
+        points[ii] = thames::util::sampling::linspace(mean[ii] + sampling.lowerBound[ii], mean[ii] + sampling.upperBound[ii], sampling.count);
+
+    // Return lazy grid of permutations
+    return thames::util::sampling::CartesianGrid<T>(points);
+}
+
+template<class T, class F>
+void propagate_set(const thames::settings::Parameters<T>& parameters, const std::vector<T>& tvec, const std::string& filepathout, F propagate_chunk, thames::settings::Parameters<T>& parameters_output) {
+    // Declare output state
+    thames::settings::StateParameters<T> state_output{};
+    state_output.statetype = parameters.states[0].statetype;
+
+    // Propagate state vectors or samples, unless states are streamed from a file or a grid
+    const bool isGrid = parameters.states[0].sampling.method == "Grid";
+    if (parameters.states[0].file.empty() && !isGrid) {
+        // Propagate
+        std::vector<std::vector<std::vector<T>>> states_propagated = propagate_chunk(input_states(parameters.states[0]), 0);
+
+        // Update output states
+        for (std::size_t ii=1; ii<states_propagated.size(); ii++) {
+            state_output.datetime = tvec[ii];
+            state_output.states = states_propagated[ii];
+            parameters_output.states.push_back(state_output);
+        }
+        return;
+    }
+
+    // Map input state file, or declare grid of samples
+    std::unique_ptr<thames::io::binary::StateFileReader<T>> reader;
+    std::unique_ptr<thames::util::sampling::CartesianGrid<T>> grid;
+    if (isGrid) {
+        grid = std::make_unique<thames::util::sampling::CartesianGrid<T>>(input_grid(parameters.states[0]));
+    } else {
+        reader = std::make_unique<thames::io::binary::StateFileReader<T>>(parameters.states[0].file);
+    }
+    const std::size_t nstates = isGrid ? grid->size() : reader->size();
+
+    // Create output state files
+    std::vector<std::unique_ptr<thames::io::binary::StateFileWriter<T>>> writers;
+    for (std::size_t ii=1; ii<tvec.size(); ii++) {
+        state_output.datetime = tvec[ii];
+        state_output.file = state_filepath(filepathout, ii);
+        parameters_output.states.push_back(state_output);
+        writers.push_back(std::make_unique<thames::io::binary::StateFileWriter<T>>(state_output.file, nstates));
+    }
+
+    // Calculate chunk size
+    const std::size_t chunksize = (parameters.propagator.chunkSize > 0) ? parameters.propagator.chunkSize : nstates;
+
+    // Declare queues between the read, propagate and write stages
+    // NOTE: each queue holds up to two chunks, so that a stage can run ahead of the next without unbounded memory
+    thames::util::pipeline::BoundedQueue<std::pair<std::size_t, std::vector<std::vector<T>>>> queue_read(2);
+    thames::util::pipeline::BoundedQueue<std::pair<std::size_t, std::vector<std::vector<std::vector<T>>>>> queue_write(2);
+    std::exception_ptr exception_read, exception_propagate, exception_write;
+
+    // Read chunks
+    std::thread thread_read([&]() {
+        try {
+            for (std::size_t start=0; start<nstates; start+=chunksize) {
+                const std::size_t count = std::min(chunksize, nstates - start);
+                thames::util::profiling::ScopedTimer timer("io/read");
+                std::vector<std::vector<T>> states = isGrid ? grid->read(start, count) : reader->read(start, count);
+                timer.stop();
+                if (!queue_read.push({start, std::move(states)}))
+                    break;
+            }
+        } catch (...) {
+            exception_read = std::current_exception();
+        }
+        queue_read.close();
+    });
+
+    // Write chunks
+    std::thread thread_write([&]() {
+        try {
+            std::pair<std::size_t, std::vector<std::vector<std::vector<T>>>> chunk;
+            while (queue_write.pop(chunk)) {
+                thames::util::profiling::ScopedTimer timer("io/write");
+                for (std::size_t ii=1; ii<tvec.size(); ii++)
+                    writers[ii-1]->write(chunk.first, chunk.second[ii]);
+            }
+        } catch (...) {
+            exception_write = std::current_exception();
+            queue_write.close();
+        }
+    });
+
+    // Propagate chunks
+    try {
+        std::pair<std::size_t, std::vector<std::vector<T>>> chunk;
+        while (queue_read.pop(chunk)) {
+            if (!queue_write.push({chunk.first, propagate_chunk(chunk.second, chunk.first)}))
+                break;
+        }
+    } catch (...) {
+        exception_propagate = std::current_exception();
+    }
+
+    // Stop reading, finish writing, and wait for the stages
+    queue_read.close();
+    queue_write.close();
+    thread_read.join();
+    thread_write.join();
+
+    // Rethrow first exception
+    for (const std::exception_ptr& exception : {exception_read, exception_propagate, exception_write}) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+
 template<class T>
-thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>& parameters) {
+std::vector<std::vector<std::vector<T>>> propagate_covariance(thames::propagators::basepropagator::BasePropagator<T>& propagator, const thames::settings::Parameters<T>& parameters, const std::vector<T>& tvec, const T tstep, const std::vector<T>& mean, const thames::constants::statetypes::StateTypes statetype, std::vector<std::vector<T>>& covariances) {
+    // Declare output
+    const std::vector<T>& covariance = parameters.states[0].covariance;
+    std::vector<std::vector<std::vector<T>>> means(tvec.size());
+    covariances.resize(tvec.size());
+
+    // Propagate covariance linearly through the state transition matrices
+    if (parameters.propagator.covarianceMethod == "STM") {
+        std::vector<std::vector<std::vector<T>>> stms;
+        means = propagator.propagate(tvec, tstep, {mean}, parameters.propagator, statetype, stms);
+        for (std::size_t ii=0; ii<tvec.size(); ii++)
+            covariances[ii] = thames::util::covariance::transform(stms[ii][0], covariance, mean.size());
+        return means;
+    }
+
+    // Propagate mean and covariance with the unscented transform
+    std::vector<std::vector<T>> means_unscented = propagator.propagate_unscented(tvec, tstep, mean, covariance, parameters.propagator, statetype, covariances);
+    for (std::size_t ii=0; ii<tvec.size(); ii++)
+        means[ii] = {means_unscented[ii]};
+    return means;
+}
+
+template<class T>
+thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>& parameters, const std::string& filepathout, PerturbationCache* cache) {
+    // Time setup of the perturbations and propagator
+    thames::util::profiling::ScopedTimer timer_setup("setup");
+
     // Load constants
     T J2 = thames::constants::earth::J2;
     T mu = thames::constants::earth::mu;
     T radius = thames::constants::earth::radius;
     T w = thames::constants::earth::w;
 
-    // Declare factors
-    auto factors = std::make_shared<thames::conversions::dimensional::DimensionalFactors<T>>();
-
-    // Set up perturbations
-    auto perturbation = std::make_shared<thames::perturbations::perturbationcombiner::PerturbationCombiner<T>>(factors);
-
-    // Set up atmosphere model
-    if (parameters.perturbation.atmosphere.isEnabled) {
-        // Select atmosphere model
-        if (parameters.perturbation.atmosphere.model == "USSA76") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::USSA76AtmosphereModel<T>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);
-        } else if (parameters.perturbation.atmosphere.model == "Wertz") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzAtmosphereModel<T>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);
-        } else if (parameters.perturbation.atmosphere.model == "Wertz-P1") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP1AtmosphereModel<T>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);   
-        } else if (parameters.perturbation.atmosphere.model == "Wertz-P5") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP5AtmosphereModel<T>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);       
-        } else {
-            throw std::runtime_error("Unsupported atmosphere model requested");
-        }        
-    }
+    // Set up perturbations, shared between runs with the same perturbation settings if cached
+    std::shared_ptr<const thames::perturbations::perturbationcombiner::PerturbationCombiner<T>> perturbation = shared_perturbation<thames::perturbations::perturbationcombiner::PerturbationCombiner<T>>(parameters, cache, [&]() {
+        auto perturbation = std::make_shared<thames::perturbations::perturbationcombiner::PerturbationCombiner<T>>();
+
+        // Set up atmosphere model
+        if (parameters.perturbation.atmosphere.isEnabled) {
+            // Select atmosphere model
+            if (parameters.perturbation.atmosphere.model == "USSA76") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::USSA76AtmosphereModel<T>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);
+            } else if (parameters.perturbation.atmosphere.model == "Wertz") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzAtmosphereModel<T>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);
+            } else if (parameters.perturbation.atmosphere.model == "Wertz-P1") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP1AtmosphereModel<T>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);   
+            } else if (parameters.perturbation.atmosphere.model == "Wertz-P5") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP5AtmosphereModel<T>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::Drag<T>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);       
+            } else {
+                throw std::runtime_error("Unsupported atmosphere model requested");
+            }        
+        }
+
+        // Set up geopotential model
+        if (parameters.perturbation.geopotential.isEnabled) {
+            // Select geopotential model
+            if (parameters.perturbation.geopotential.model == "J2") {
+                auto geopotentialmodel = std::make_shared<thames::perturbations::geopotential::J2<T>>(mu, J2, radius);
+                perturbation->add_model(geopotentialmodel);
+            } else {
+                throw std::runtime_error("Unsupported geopotential model requested");
+            }
+        }
 
-    // Set up geopotential model
-    if (parameters.perturbation.geopotential.isEnabled) {
-        // Select geopotential model
-        if (parameters.perturbation.geopotential.model == "J2") {
-            auto geopotentialmodel = std::make_shared<thames::perturbations::geopotential::J2<T>>(mu, J2, radius, factors);
-            perturbation->add_model(geopotentialmodel);
+        // Return perturbations
+        return perturbation;
+    });
+
+    // Set up events
+    std::vector<std::shared_ptr<const thames::propagators::events::BaseEvent<T>>> events;
+    for (const thames::settings::EventParameters<T>& event : parameters.propagator.events) {
+        // Select event type
+        if (event.type == "Altitude") {
+            events.push_back(std::make_shared<thames::propagators::events::AltitudeEvent<T>>(radius, event.altitude, event.isTerminal, event.direction));
+        } else if (event.type == "Eclipse") {
+            events.push_back(std::make_shared<thames::propagators::events::EclipseEvent<T>>(radius, event.sunDirection, event.isTerminal, event.direction));
+        } else if (event.type == "Node") {
+            events.push_back(std::make_shared<thames::propagators::events::NodeEvent<T>>(event.isTerminal, event.direction));
         } else {
-            throw std::runtime_error("Unsupported geopotential model requested");
+            throw std::runtime_error("Unsupported event requested");
         }
     }
 
@@ -88,8 +347,6 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
     } else {
         tvec = {tstart, tend};
     }
-    std::vector<std::vector<T>> states = parameters.states[0].states;
-    std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size());
 
     // Import state type
     thames::constants::statetypes::StateTypes statetype;
@@ -103,20 +360,43 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
         throw std::runtime_error("Unsupported state type provided");
     }
 
-    // Propagator
+    // Set up propagator
+    std::shared_ptr<thames::propagators::basepropagator::BasePropagator<T>> propagator;
     if (parameters.propagator.equations == "Cowell") {
-        // Set up propagator
-        auto propagator = thames::propagators::CowellPropagator<T>(mu, perturbation, factors);
-        // Propagate
-        states_propagated = propagator.propagate(tvec, tstep, states, parameters.propagator, statetype);
+        propagator = std::make_shared<thames::propagators::CowellPropagator<T>>(mu, perturbation);
     } else if (parameters.propagator.equations == "GEqOE") {
-        // Set up propagator
-        auto propagator = thames::propagators::GEqOEPropagator<T>(mu, perturbation, factors);
-        // Propagate
-        states_propagated = propagator.propagate(tvec, tstep, states, parameters.propagator, statetype);        
+        propagator = std::make_shared<thames::propagators::GEqOEPropagator<T>>(mu, perturbation);
     } else {
         throw std::runtime_error("Unsupported propagator requested");
     }
+    timer_setup.stop();
+
+    // Declare propagation of a set of states, with event samples offset by the index of the first state
+    std::vector<thames::propagators::events::EventOccurrence<T>> occurrences;
+    std::vector<std::vector<std::vector<T>>> stms;
+    std::vector<std::vector<T>> covariances;
+    auto propagate_chunk = [&](const std::vector<std::vector<T>>& states, const std::size_t offset) {
+        // Propagate mean and covariance
+        if (!parameters.propagator.covarianceMethod.empty())
+            return propagate_covariance(*propagator, parameters, tvec, tstep, states[0], statetype, covariances);
+
+        // Propagate with state transition matrices
+        if (!parameters.propagator.stateTransitionMatrix.empty())
+            return propagator->propagate(tvec, tstep, states, parameters.propagator, statetype, stms);
+
+        // Propagate without events
+        if (events.empty())
+            return propagator->propagate(tvec, tstep, states, parameters.propagator, statetype);
+
+        // Propagate with events
+        std::vector<thames::propagators::events::EventOccurrence<T>> occurrences_chunk;
+        std::vector<std::vector<std::vector<T>>> states_propagated = propagator->propagate(tvec, tstep, states, parameters.propagator, statetype, events, occurrences_chunk);
+        for (thames::propagators::events::EventOccurrence<T>& occurrence : occurrences_chunk) {
+            occurrence.sample += offset;
+            occurrences.push_back(occurrence);
+        }
+        return states_propagated;
+    };
 
     // Declare output structure
     thames::settings::Parameters<T> parameters_output(parameters);
@@ -124,13 +404,27 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
     // Set flag
     parameters_output.metadata.isInputFile = false;
 
-    // Update output states
-    thames::settings::StateParameters<T> state_output;
-    for (std::size_t ii=1; ii<states_propagated.size(); ii++) {
-        state_output.datetime = tvec[ii];
-        state_output.states = states_propagated[ii];
-        state_output.statetype = parameters.states[0].statetype;
-        parameters_output.states.push_back(state_output);
+    // Propagate and update output states
+    propagate_set(parameters, tvec, filepathout, propagate_chunk, parameters_output);
+
+    // Update output state transition matrices
+    for (std::size_t ii=1; ii<stms.size(); ii++)
+        parameters_output.states[ii].stms = stms[ii];
+
+    // Update output covariances
+    for (std::size_t ii=1; ii<covariances.size(); ii++)
+        parameters_output.states[ii].covariance = covariances[ii];
+
+    // Update output events
+    thames::settings::EventRecord<T> event_output;
+    for (const thames::propagators::events::EventOccurrence<T>& occurrence : occurrences) {
+        event_output.event = occurrence.event;
+        event_output.type = parameters.propagator.events[occurrence.event].type;
+        event_output.sample = occurrence.sample;
+        event_output.datetime = occurrence.time;
+        event_output.state = occurrence.state;
+        event_output.isTerminal = occurrence.isTerminal;
+        parameters_output.events.push_back(event_output);
     }
 
     // Return parameters
@@ -138,53 +432,58 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
 }
 
 template<class T, template <class> class P>
-thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>& parameters) {
+thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>& parameters, const std::string& filepathout, PerturbationCache* cache) {
+    // Time setup of the perturbations and propagator
+    thames::util::profiling::ScopedTimer timer_setup("setup");
+
     // Load constants
     T J2 = thames::constants::earth::J2;
     T mu = thames::constants::earth::mu;
     T radius = thames::constants::earth::radius;
     T w = thames::constants::earth::w;
 
-    // Declare factors
-    auto factors = std::make_shared<thames::conversions::dimensional::DimensionalFactors<T>>();
-
-    // Set up perturbations
-    auto perturbation = std::make_shared<thames::perturbations::perturbationcombiner::PerturbationCombinerPolynomial<T, P>>(factors);
-
-    // Set up atmosphere model
-    if (parameters.perturbation.atmosphere.isEnabled) {
-        // Select atmosphere model
-        if (parameters.perturbation.atmosphere.model == "USSA76") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::USSA76AtmosphereModelPolynomial<T, P>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);
-        } else if (parameters.perturbation.atmosphere.model == "Wertz") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzAtmosphereModelPolynomial<T, P>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);
-        } else if (parameters.perturbation.atmosphere.model == "Wertz-P1") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP1AtmosphereModelPolynomial<T, P>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);
-        } else if (parameters.perturbation.atmosphere.model == "Wertz-P5") {
-            auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP5AtmosphereModelPolynomial<T, P>>();
-            auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel, factors);
-            perturbation->add_model(atmosphereperturbation);
-        } else {
-            throw std::runtime_error("Unsupported atmosphere model requested");
-        }        
-    }
+    // Set up perturbations, shared between runs with the same perturbation settings if cached
+    std::shared_ptr<const thames::perturbations::perturbationcombiner::PerturbationCombinerPolynomial<T, P>> perturbation = shared_perturbation<thames::perturbations::perturbationcombiner::PerturbationCombinerPolynomial<T, P>>(parameters, cache, [&]() {
+        auto perturbation = std::make_shared<thames::perturbations::perturbationcombiner::PerturbationCombinerPolynomial<T, P>>();
+
+        // Set up atmosphere model
+        if (parameters.perturbation.atmosphere.isEnabled) {
+            // Select atmosphere model
+            if (parameters.perturbation.atmosphere.model == "USSA76") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::USSA76AtmosphereModelPolynomial<T, P>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);
+            } else if (parameters.perturbation.atmosphere.model == "Wertz") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzAtmosphereModelPolynomial<T, P>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);
+            } else if (parameters.perturbation.atmosphere.model == "Wertz-P1") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP1AtmosphereModelPolynomial<T, P>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);
+            } else if (parameters.perturbation.atmosphere.model == "Wertz-P5") {
+                auto atmospheremodel = std::make_shared<thames::perturbations::atmosphere::models::WertzP5AtmosphereModelPolynomial<T, P>>();
+                auto atmosphereperturbation = std::make_shared<thames::perturbations::atmosphere::drag::DragPolynomial<T, P>>(radius, w, parameters.spacecraft.Cd, parameters.spacecraft.dragArea, parameters.spacecraft.mass, atmospheremodel);
+                perturbation->add_model(atmosphereperturbation);
+            } else {
+                throw std::runtime_error("Unsupported atmosphere model requested");
+            }        
+        }
 
-    // Set up geopotential model
-    if (parameters.perturbation.geopotential.isEnabled) {
-        // Select geopotential model
-        if (parameters.perturbation.geopotential.model == "J2") {
-            auto geopotentialmodel = std::make_shared<thames::perturbations::geopotential::J2Polynomial<T, P>>(mu, J2, radius, factors);
-            perturbation->add_model(geopotentialmodel);
-        } else {
-            throw std::runtime_error("Unsupported geopotential model requested");
+        // Set up geopotential model
+        if (parameters.perturbation.geopotential.isEnabled) {
+            // Select geopotential model
+            if (parameters.perturbation.geopotential.model == "J2") {
+                auto geopotentialmodel = std::make_shared<thames::perturbations::geopotential::J2Polynomial<T, P>>(mu, J2, radius);
+                perturbation->add_model(geopotentialmodel);
+            } else {
+                throw std::runtime_error("Unsupported geopotential model requested");
+            }
         }
-    }
+
+        // Return perturbations
+        return perturbation;
+    });
 
     // Import states
     T tstart = parameters.propagator.startTime;
@@ -198,11 +497,12 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
     } else {
         tvec = {tstart, tend};
     }
-    std::vector<std::vector<T>> states = parameters.states[0].states;
-    std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size());
 
     // Import polynomial parameters
     unsigned int degree = parameters.polynomial.maxDegree;
+    T threshold = parameters.polynomial.coefficientThreshold;
+    T splitThreshold = parameters.polynomial.splitThreshold;
+    unsigned int maxSplitDepth = parameters.polynomial.maxSplitDepth;
 
     // Import state type
     thames::constants::statetypes::StateTypes statetype;
@@ -216,20 +516,53 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
         throw std::runtime_error("Unsupported state type provided");
     }
 
-    // Propagator
+    // Set up propagator
+    std::shared_ptr<thames::propagators::basepropagator::BasePropagatorPolynomial<T, P>> propagator;
     if (parameters.propagator.equations == "Cowell") {
-        // Set up propagator
-        auto propagator = thames::propagators::CowellPropagatorPolynomial<T, P>(mu, perturbation, factors);
-        // Propagate
-        states_propagated = propagator.propagate(tvec, tstep, states, parameters.propagator, statetype, degree);
+        propagator = std::make_shared<thames::propagators::CowellPropagatorPolynomial<T, P>>(mu, perturbation);
     } else if (parameters.propagator.equations == "GEqOE") {
-        // Set up propagator
-        auto propagator = thames::propagators::GEqOEPropagatorPolynomial<T, P>(mu, perturbation, factors);
-        // Propagate
-        states_propagated = propagator.propagate(tvec, tstep, states, parameters.propagator, statetype, degree);        
+        propagator = std::make_shared<thames::propagators::GEqOEPropagatorPolynomial<T, P>>(mu, perturbation);
     } else {
         throw std::runtime_error("Unsupported propagator requested");
     }
+    timer_setup.stop();
+
+    // Load flow map, if requested, and check that it matches the requested propagation
+    thames::propagators::flowmap::FlowMap<T> map;
+    if (!parameters.polynomial.flowMapInput.empty()) {
+        thames::io::json::load(parameters.polynomial.flowMapInput, map);
+        if (statetype != thames::constants::statetypes::CARTESIAN || map.basis != thames::util::polynomials::polynomial_basis<P>() || map.tvec != tvec)
+            throw std::runtime_error("Flow map inconsistent with requested propagation");
+    }
+
+    // Declare propagation of a set of states
+    // NOTE: each chunk of a state file is propagated as a separate polynomial domain
+    std::vector<std::vector<std::vector<T>>> stms;
+    auto propagate_chunk = [&](const std::vector<std::vector<T>>& states, const std::size_t offset) {
+        // Propagate each state with state transition matrices from first-degree polynomials
+        if (!parameters.propagator.stateTransitionMatrix.empty()) {
+            std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), std::vector<std::vector<T>>(states.size()));
+            stms.assign(tvec.size(), std::vector<std::vector<T>>(states.size()));
+            for (std::size_t ii=0; ii<states.size(); ii++) {
+                std::vector<std::vector<T>> stms_state;
+                std::vector<std::vector<T>> states_state = propagator->propagate(tvec, tstep, states[ii], parameters.propagator, statetype, stms_state);
+                for (std::size_t jj=0; jj<tvec.size(); jj++) {
+                    states_propagated[jj][ii] = states_state[jj];
+                    stms[jj][ii] = stms_state[jj];
+                }
+            }
+            return states_propagated;
+        }
+
+        // Evaluate flow map in place of propagation
+        if (!parameters.polynomial.flowMapInput.empty())
+            return thames::propagators::flowmap::evaluate(map, states, (T) parameters.polynomial.flowMapMargin);
+
+        // Propagate, storing the flow map if requested
+        if (!parameters.polynomial.flowMapOutput.empty())
+            return propagator->propagate(tvec, tstep, states, parameters.propagator, statetype, degree, threshold, splitThreshold, maxSplitDepth, map);
+        return propagator->propagate(tvec, tstep, states, parameters.propagator, statetype, degree, threshold, splitThreshold, maxSplitDepth);
+    };
 
     // Declare output structure
     thames::settings::Parameters<T> parameters_output(parameters);
@@ -237,44 +570,37 @@ thames::settings::Parameters<T> propagate(const thames::settings::Parameters<T>&
     // Set flag
     parameters_output.metadata.isInputFile = false;
 
-    // Update output states
-    thames::settings::StateParameters<T> state_output;
-    for (std::size_t ii=1; ii<states_propagated.size(); ii++) {
-        state_output.datetime = tvec[ii];
-        state_output.states = states_propagated[ii];
-        state_output.statetype = parameters.states[0].statetype;
-        parameters_output.states.push_back(state_output);
-    }
+    // Propagate and update output states
+    propagate_set(parameters, tvec, filepathout, propagate_chunk, parameters_output);
+
+    // Update output state transition matrices
+    for (std::size_t ii=1; ii<stms.size(); ii++)
+        parameters_output.states[ii].stms = stms[ii];
+
+    // Output flow map
+    if (parameters.polynomial.flowMapInput.empty() && !parameters.polynomial.flowMapOutput.empty())
+        thames::io::json::save(parameters.polynomial.flowMapOutput, map);
 
     // Return parameters
     return parameters_output;
 }
 
-int main(int argc, char **argv) {
-    // Declare filepath strings
-    std::string filepathin, filepathout;
-
-    // Use either default input/output filepaths (if no arguments are provided) or specified filepaths
-    if (argc == 1) {
-        filepathin = "input.json";
-        filepathout = "output.json";
-    } else if (argc == 3) {
-        filepathin = argv[1];
-        filepathout = argv[2];
-    } else {
-        throw std::runtime_error("Incorrect number of arguments provided");
-    }
-
-    // Load input file
-    thames::settings::Parameters<double> parameters, parameters_output;
-    thames::io::json::load(filepathin, parameters);
-
+template<class T>
+thames::settings::Parameters<T> run(const thames::settings::Parameters<T>& parameters, const std::string& filepathout, PerturbationCache* cache = nullptr) {
     // Throw error if polynomial propagation requested with version of THAMES not compiled with SMART-UQ support
     #ifndef THAMES_USE_SMARTUQ
     if (parameters.polynomial.isEnabled)
         throw std::runtime_error("Polynomial propagation requested for version of THAMES not compiled with SMART-UQ");
     #endif
 
+    // Throw error if events requested for polynomial propagation
+    if (parameters.polynomial.isEnabled && !parameters.propagator.events.empty())
+        throw std::runtime_error("Events are not supported for polynomial propagation");
+
+    // Throw error if events requested for ensemble propagation, as states with events are propagated individually
+    if (!parameters.propagator.events.empty() && (parameters.propagator.ensembleSize > 1 || parameters.propagator.isMixedPrecision))
+        throw std::runtime_error("Events are not supported for ensemble or mixed-precision propagation");
+
     // Check valid input parameters
     if (!parameters.metadata.isInputFile)
         throw std::runtime_error("Input file flag set to false");
@@ -283,31 +609,324 @@ int main(int argc, char **argv) {
     if (parameters.states[0].datetime != parameters.propagator.startTime)
         throw std::runtime_error("Inconsistent start times provided");
 
+    // Check precision against the numeric type of the propagation
+    const std::string& precision = parameters.propagator.precision;
+    if (precision != precision_name<T>() && !(precision.empty() && std::is_same<T, double>::value))
+        throw std::runtime_error("Requested precision inconsistent with the propagation");
+    if (parameters.polynomial.isEnabled && !std::is_same<T, double>::value)
+        throw std::runtime_error("Polynomial propagation requires double precision");
+
+    // Check sampling parameters
+    const thames::settings::SamplingParameters<T>& sampling = parameters.states[0].sampling;
+    if (!sampling.method.empty()) {
+        if (parameters.states[0].states.size() != 1 || !parameters.states[0].file.empty())
+            throw std::runtime_error("Sampling requires a single mean state, without a state file");
+        if (sampling.lowerBound.size() != parameters.states[0].states[0].size() || sampling.upperBound.size() != parameters.states[0].states[0].size() || sampling.count == 0)
+            throw std::runtime_error("Sampling requires bounds for each state variable and a non-zero sample count");
+    }
+
+    // Check mixed-precision propagation against the propagation, as every other path runs in full precision
+    if (parameters.propagator.isMixedPrecision) {
+        if (parameters.polynomial.isEnabled || parameters.propagator.ensembleSize < 2)
+            throw std::runtime_error("Mixed-precision propagation requires point propagation of ensembles");
+        if (!parameters.propagator.events.empty() || !parameters.propagator.stateTransitionMatrix.empty() || parameters.propagator.covarianceMethod == "STM" || (!parameters.propagator.covarianceMethod.empty() && parameters.propagator.unscentedThreads > 1))
+            throw std::runtime_error("Mixed-precision propagation is not supported with events, state transition matrices, or covariance propagation other than the unscented transform with its sigma points propagated as a set");
+    }
+
+    // Check state transition matrix method against the propagation
+    const std::string& stm = parameters.propagator.stateTransitionMatrix;
+    if (!stm.empty()) {
+        if (stm != "Variational" && stm != "Taylor")
+            throw std::runtime_error("Unsupported state transition matrix method requested");
+        if (parameters.polynomial.isEnabled != (stm == "Taylor"))
+            throw std::runtime_error("Variational state transition matrices require point propagation, and Taylor state transition matrices require polynomial propagation");
+        if (!parameters.propagator.events.empty() || !parameters.states[0].file.empty() || sampling.method == "Grid" || !parameters.polynomial.flowMapInput.empty() || !parameters.polynomial.flowMapOutput.empty())
+            throw std::runtime_error("State transition matrices are not supported with events, state files, grid sampling, or flow maps");
+        if (parameters.propagator.ensembleSize > 1)
+            throw std::runtime_error("State transition matrices are not supported for ensemble propagation");
+    }
+
+    // Check covariance propagation against the propagation
+    const std::string& covariance = parameters.propagator.covarianceMethod;
+    if (!covariance.empty()) {
+        if (covariance != "STM" && covariance != "Unscented")
+            throw std::runtime_error("Unsupported covariance method requested");
+        if (parameters.polynomial.isEnabled || !stm.empty() || !parameters.propagator.events.empty() || !parameters.states[0].file.empty() || !sampling.method.empty())
+            throw std::runtime_error("Covariance propagation requires point propagation without state transition matrices, events, state files, or sampling");
+        if (parameters.states[0].states.size() != 1 || parameters.states[0].covariance.size() != parameters.states[0].states[0].size()*parameters.states[0].states[0].size())
+            throw std::runtime_error("Covariance propagation requires a single mean state and its covariance");
+        if (parameters.propagator.ensembleSize > 1 && (covariance == "STM" || parameters.propagator.unscentedThreads > 1))
+            throw std::runtime_error("Ensemble propagation of covariances requires the unscented transform with its sigma points propagated as a set");
+    }
+
+    // Declare output parameters
+    thames::settings::Parameters<T> parameters_output;
+
     // Start timer for propagation
     auto start_propagation = std::chrono::high_resolution_clock::now();
 
     // Propagate
+    // NOTE: polynomial propagation is only instantiated in double precision
     if (parameters.polynomial.isEnabled) {
-        if (parameters.polynomial.type == "Taylor") {
-            parameters_output = propagate<double, smartuq::polynomial::taylor_polynomial>(parameters);
-        } else if (parameters.polynomial.type == "Chebyshev") {
-            parameters_output = propagate<double, smartuq::polynomial::chebyshev_polynomial>(parameters);
-        } else {
-            throw std::runtime_error("Unsupported polynomial type requested");
+        if constexpr (std::is_same<T, double>::value) {
+            if (parameters.polynomial.type == "Taylor") {
+                parameters_output = propagate<T, smartuq::polynomial::taylor_polynomial>(parameters, filepathout, cache);
+            } else if (parameters.polynomial.type == "Chebyshev") {
+                parameters_output = propagate<T, smartuq::polynomial::chebyshev_polynomial>(parameters, filepathout, cache);
+            } else {
+                throw std::runtime_error("Unsupported polynomial type requested");
+            }
         }
     } else {
-        parameters_output = propagate<double>(parameters);
+        parameters_output = propagate<T>(parameters, filepathout, cache);
     }
 
     // Start timer for propagation
     auto end_propagation = std::chrono::high_resolution_clock::now();
 
     // Store propagation statistics
-    std::chrono::duration<double> elapsed_propagation = end_propagation - start_propagation;
+    std::chrono::duration<T> elapsed_propagation = end_propagation - start_propagation;
     parameters_output.statistics.propagationTime = elapsed_propagation.count();
 
+    // Store profiled sections
+    if (thames::util::profiling::is_enabled()) {
+        for (const thames::util::profiling::TimerStatistics& timer : thames::util::profiling::report())
+            parameters_output.statistics.timers.push_back({timer.name, timer.count, (T) timer.totalTime});
+    }
+
+    // Return parameters
+    return parameters_output;
+}
+
+template<class T>
+thames::util::statistics::ErrorStatistics<T> compare_states(const thames::settings::StateParameters<T>& state, const thames::settings::StateParameters<T>& reference) {
+    // Check states are comparable
+    if (state.statetype != "Cartesian" || reference.statetype != "Cartesian")
+        throw std::runtime_error("Error statistics require Cartesian states");
+    if (state.datetime != reference.datetime)
+        throw std::runtime_error("Inconsistent times of states and reference states");
+
+    // Compare state vectors directly
+    if (state.file.empty() && reference.file.empty())
+        return thames::util::statistics::error_statistics(state.states, reference.states);
+
+    // Map state files, and compare in chunks
+    std::unique_ptr<thames::io::binary::StateFileReader<T>> reader, reader_reference;
+    if (!state.file.empty())
+        reader = std::make_unique<thames::io::binary::StateFileReader<T>>(state.file);
+    if (!reference.file.empty())
+        reader_reference = std::make_unique<thames::io::binary::StateFileReader<T>>(reference.file);
+    const std::size_t nstates = reader ? reader->size() : state.states.size();
+    const std::size_t nstates_reference = reader_reference ? reader_reference->size() : reference.states.size();
+    if (nstates != nstates_reference)
+        throw std::runtime_error("Inconsistent number of samples for error statistics");
+    const std::size_t chunksize = 65536;
+    thames::util::statistics::ErrorAccumulator<T> accumulator;
+    for (std::size_t start=0; start<nstates; start+=chunksize) {
+        const std::size_t count = std::min(chunksize, nstates - start);
+        const std::vector<std::vector<T>> states = reader ? reader->read(start, count) : std::vector<std::vector<T>>(state.states.begin() + start, state.states.begin() + start + count);
+        const std::vector<std::vector<T>> states_reference = reader_reference ? reader_reference->read(start, count) : std::vector<std::vector<T>>(reference.states.begin() + start, reference.states.begin() + start + count);
+        accumulator.add(states, states_reference);
+    }
+    return accumulator.statistics();
+}
+
+// Input and reference runs of a sweep in one precision, loaded on first use
+template<class T>
+struct SweepInputs {
+    /// Flag for whether the runs have been loaded
+    std::once_flag flag;
+
+    /// Input run
+    thames::settings::Parameters<T> parameters;
+
+    /// Reference run
+    thames::settings::Parameters<T> reference;
+
+    /// Load runs, if not already loaded
+    const SweepInputs& load(const std::string& filepathin, const std::string& filepathreference) {
+        std::call_once(flag, [&]() {
+            thames::io::json::load(filepathin, parameters);
+            if (!filepathreference.empty())
+                thames::io::json::load(filepathreference, reference);
+        });
+        return *this;
+    }
+};
+
+template<class T>
+void sweep_case(const SweepInputs<T>& inputs, const thames::settings::SweepParameters& sweep, const std::size_t index, const nlohmann::json& values, const std::string& directoryout, PerturbationCache& cache, std::ostream& statistics, std::mutex& mutex, nlohmann::json& entry) {
+    // Generate case parameters, sharing the input states
+    thames::settings::Parameters<T> parameters_case(inputs.parameters);
+    thames::io::json::apply_values(parameters_case, values);
+
+    // Propagate, sharing perturbations with the other cases
+    std::string filename = "case_" + std::to_string(index) + ".json";
+    std::string filepath = (std::filesystem::path(directoryout) / filename).string();
+    thames::settings::Parameters<T> parameters_output = run(parameters_case, filepath, &cache);
+
+    // Output case file
+    thames::io::json::save(filepath, parameters_output);
+
+    // Update summary entry
+    entry["status"] = "completed";
+    entry["file"] = filename;
+    entry["propagationTime"] = parameters_output.statistics.propagationTime;
+
+    // Calculate error statistics against the reference run, and stream them
+    if (!sweep.reference.empty()) {
+        if (parameters_output.states.size() != inputs.reference.states.size())
+            throw std::runtime_error("Inconsistent output times of case and reference run");
+        std::ostringstream rows;
+        rows << std::setprecision(std::numeric_limits<T>::max_digits10);
+        for (std::size_t jj=0; jj<parameters_output.states.size(); jj++)
+            rows << index << "," << parameters_output.states[jj].datetime << "," << thames::util::statistics::csv_row(compare_states(parameters_output.states[jj], inputs.reference.states[jj])) << "\n";
+        std::lock_guard<std::mutex> lock(mutex);
+        statistics << rows.str() << std::flush;
+    }
+}
+
+void sweep(const std::string& filepathin, const thames::settings::SweepParameters& sweep, const std::string& directoryout) {
+    // Create output directory
+    std::filesystem::create_directories(directoryout);
+
+    // Open summary file, with one line per completed case
+    std::ofstream summary(std::filesystem::path(directoryout) / "sweep.jsonl");
+    std::mutex summary_mutex;
+
+    // Load input and reference runs in double precision, and in other precisions on first use by a case
+    SweepInputs<double> inputs_double;
+    SweepInputs<float> inputs_float;
+    SweepInputs<long double> inputs_long;
+    inputs_double.load(filepathin, sweep.reference);
+
+    // Open statistics file, with one line per output time of each completed case
+    std::ofstream statistics;
+    if (!sweep.reference.empty()) {
+        statistics.open(std::filesystem::path(directoryout) / "statistics.csv");
+        statistics << "case,datetime," << thames::util::statistics::csv_header() << std::endl;
+    }
+
+    // Declare perturbations shared between cases
+    PerturbationCache cache;
+
+    // Calculate number of cases
+    const std::size_t ncases = thames::io::json::sweep_size(sweep);
+
+    // Create thread pool
+    thames::util::threadpool::WorkStealingPool pool(sweep.threads);
+
+    // Submit cases
+    for (std::size_t ii=0; ii<ncases; ii++) {
+        pool.submit([&, ii]() {
+            // Generate case values
+            nlohmann::json values = thames::io::json::sweep_case(sweep, ii);
+
+            // Declare summary entry
+            nlohmann::json entry = {{"case", ii}, {"parameters", values}};
+
+            try {
+                // Propagate in the precision of the case, as for single runs
+                const std::string precision = values.contains("propagator.precision") ? values["propagator.precision"].get<std::string>() : inputs_double.parameters.propagator.precision;
+                if (precision.empty() || precision == "Double") {
+                    sweep_case(inputs_double, sweep, ii, values, directoryout, cache, statistics, summary_mutex, entry);
+                } else if (precision == "Float") {
+                    sweep_case(inputs_float.load(filepathin, sweep.reference), sweep, ii, values, directoryout, cache, statistics, summary_mutex, entry);
+                } else if (precision == "LongDouble") {
+                    sweep_case(inputs_long.load(filepathin, sweep.reference), sweep, ii, values, directoryout, cache, statistics, summary_mutex, entry);
+                } else {
+                    throw std::runtime_error("Unsupported precision requested");
+                }
+            } catch (const std::exception& error) {
+                // Record failed case
+                entry["status"] = "failed";
+                entry["message"] = error.what();
+            }
+
+            // Stream summary entry
+            std::lock_guard<std::mutex> lock(summary_mutex);
+            summary << entry.dump() << std::endl;
+        });
+    }
+
+    // Wait for cases to complete
+    pool.wait();
+}
+
+template<class T>
+void execute(const thames::settings::Parameters<T>& parameters, const std::string& filepathout, const thames::util::profiling::Clock::time_point start_load) {
+    // Enable profiling, if requested, including the load of the input file
+    if (parameters.profiling.isEnabled) {
+        thames::util::profiling::enable(!parameters.profiling.traceOutput.empty(), parameters.profiling.perturbationSampling);
+        thames::util::profiling::record("serialisation/load", start_load, thames::util::profiling::Clock::now());
+    }
+
+    // Propagate
+    thames::settings::Parameters<T> parameters_output = run(parameters, filepathout);
+
     // Output file
-    thames::io::json::save(filepathout, parameters_output);
+    {
+        thames::util::profiling::ScopedTimer timer("serialisation/save");
+        thames::io::json::save(filepathout, parameters_output);
+    }
+
+    // Output trace of the profiled sections, if requested
+    if (parameters.profiling.isEnabled && !parameters.profiling.traceOutput.empty())
+        thames::util::profiling::save_trace(parameters.profiling.traceOutput);
+}
+
+int main(int argc, char **argv) {
+    // Run parameter sweep if requested
+    if (argc > 1 && std::string(argv[1]) == "--sweep") {
+        // Check arguments
+        if (argc != 5)
+            throw std::runtime_error("Usage: thames_main --sweep <input> <sweep> <output directory>");
+
+        // Load sweep file
+        thames::settings::SweepParameters sweep_parameters;
+        thames::io::json::load(argv[3], sweep_parameters);
+
+        // Run sweep, loading the input file in the precision of each case
+        // NOTE: profiling is process-wide, so it is not enabled for the concurrent cases of a sweep
+        sweep(argv[2], sweep_parameters, argv[4]);
+
+        return 0;
+    }
+
+    // Declare filepath strings
+    std::string filepathin, filepathout;
+
+    // Use either default input/output filepaths (if no arguments are provided) or specified filepaths
+    if (argc == 1) {
+        filepathin = "input.json";
+        filepathout = "output.json";
+    } else if (argc == 3) {
+        filepathin = argv[1];
+        filepathout = argv[2];
+    } else {
+        throw std::runtime_error("Incorrect number of arguments provided");
+    }
+
+    // Load input file
+    auto start_load = thames::util::profiling::Clock::now();
+    thames::settings::Parameters<double> parameters;
+    thames::io::json::load(filepathin, parameters);
+
+    // Propagate in the requested precision, reloading the input file in that precision
+    const std::string& precision = parameters.propagator.precision;
+    if (precision.empty() || precision == "Double") {
+        execute(parameters, filepathout, start_load);
+    } else if (precision == "Float") {
+        thames::settings::Parameters<float> parameters_float;
+        thames::io::json::load(filepathin, parameters_float);
+        execute(parameters_float, filepathout, start_load);
+    } else if (precision == "LongDouble") {
+        thames::settings::Parameters<long double> parameters_long;
+        thames::io::json::load(filepathin, parameters_long);
+        execute(parameters_long, filepathout, start_load);
+    } else {
+        throw std::runtime_error("Unsupported precision requested");
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -28,7 +28,6 @@ import os
 
 import numpy as np
 import pandas as pd
-import smt.sampling_methods
 
 import pythames.dataclasses
 import pythames.interface
@@ -49,14 +48,8 @@ def main():
     RVunc = np.array([0.1, 0.1, 0.1, 0.01, 0.01, 0.01])
     T = 5580.515898
 
-    # Generate initial state boundaries
-    RVupper = RV + RVunc
-    RVlower = RV - RVunc
-    RVbound = np.vstack([RVlower, RVupper]).T
-
-    # Sample initial boundaries
-    lhs = smt.sampling_methods.LHS(xlimits=RVbound)
-    RVsamples = lhs(int(1e4)).tolist()
+    # Sample initial boundaries in THAMES
+    sampling = pythames.dataclasses.SamplingParameters("LHS", int(1e4), (-RVunc).tolist(), RVunc.tolist(), 0, 0)
 
     ## Generate parameter set
     # Generate propagator sets
@@ -91,7 +84,8 @@ def main():
     states = pythames.permutations.dataclass_permutations(
         pythames.dataclasses.StateParameters,
         pythames.permutations.STATEPARAMETERS_DEFAULT,
-        states=[RVsamples]
+        states=[[RV.tolist()]],
+        sampling=[sampling]
     )
 
     # Generate polynomial sets
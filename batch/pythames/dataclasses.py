@@ -63,6 +63,15 @@ class PerturbationParameters:
     geopotential: GeopotentialPerturbationParameters
     atmosphere: AtmospherePerturbationParameters
 
+@dataclasses_json.dataclass_json
+@dataclasses.dataclass
+class EventParameters:
+    type: str
+    isTerminal: bool
+    direction: int
+    altitude: float
+    sunDirection: List[float]
+
 @dataclasses_json.dataclass_json
 @dataclasses.dataclass
 class PropagatorParameters:
@@ -76,6 +85,18 @@ class PropagatorParameters:
     timeStep: float
     absoluteTolerance: float
     relativeTolerance: float
+    ensembleSize: int
+    isMixedPrecision: bool
+    evaluationThreads: int
+    events: List[EventParameters]
+    chunkSize: int
+    stateTransitionMatrix: str
+    covarianceMethod: str
+    unscentedAlpha: float
+    unscentedBeta: float
+    unscentedKappa: float
+    unscentedThreads: int
+    precision: str
 
 @dataclasses_json.dataclass_json
 @dataclasses.dataclass
@@ -83,6 +104,29 @@ class PolynomialParameters:
     isEnabled: bool
     type: str
     maxDegree: int
+    coefficientThreshold: float
+    splitThreshold: float
+    maxSplitDepth: int
+    flowMapOutput: str
+    flowMapInput: str
+    flowMapMargin: float
+
+@dataclasses_json.dataclass_json
+@dataclasses.dataclass
+class ProfilingParameters:
+    isEnabled: bool
+    perturbationSampling: int
+    traceOutput: str
+
+@dataclasses_json.dataclass_json
+@dataclasses.dataclass
+class SamplingParameters:
+    method: str
+    count: int
+    lowerBound: List[float]
+    upperBound: List[float]
+    seed: int
+    threads: int
 
 @dataclasses_json.dataclass_json
 @dataclasses.dataclass
@@ -90,11 +134,33 @@ class StateParameters:
     datetime: float
     states: List[List[float]]
     statetype: str
+    file: str
+    stms: List[List[float]]
+    covariance: List[float]
+    sampling: SamplingParameters
+
+@dataclasses_json.dataclass_json
+@dataclasses.dataclass
+class EventRecord:
+    event: int
+    type: str
+    sample: int
+    datetime: float
+    state: List[float]
+    isTerminal: bool
+
+@dataclasses_json.dataclass_json
+@dataclasses.dataclass
+class ProfileEntry:
+    name: str
+    count: int
+    totalTime: float
 
 @dataclasses_json.dataclass_json
 @dataclasses.dataclass
 class ExecutionStatistics:
     propagationTime: float
+    timers: List[ProfileEntry]
 
 @dataclasses_json.dataclass_json
 @dataclasses.dataclass
@@ -104,7 +170,9 @@ class Parameters:
     perturbation: PerturbationParameters
     propagator: PropagatorParameters
     polynomial: PolynomialParameters
+    profiling: ProfilingParameters
     states: List[StateParameters]
+    events: List[EventRecord]
     statistics: ExecutionStatistics
 
 @dataclasses_json.dataclass_json
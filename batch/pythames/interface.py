@@ -23,6 +23,7 @@
 # SOFTWARE.
 
 import datetime
+import json
 import multiprocessing
 import subprocess
 import os
@@ -117,5 +118,31 @@ def batch_run(command: str, parametersin: List[Parameters], batchpath: Optional[
             # Append to output list
             parametersout.append(iparamout)
 
+    # Return output
+    return parametersout
+
+def sweep_run(command: str, parametersin: Parameters, sweep: dict, batchpath: Optional[str] = None, threads: Optional[int] = 0, reference: Optional[str] = "") -> List[Parameters]:
+    # Define (and create) output directory
+    folderpath = os.getcwd()
+    if batchpath is None: batchpath = os.path.join(folderpath, "output", datetime.datetime.utcnow().isoformat(sep='T', timespec="seconds"))
+    if not os.path.exists(batchpath): os.makedirs(batchpath)
+
+    # Save input and sweep files
+    filepathin = os.path.join(batchpath, "input.json")
+    filepathsweep = os.path.join(batchpath, "sweep.json")
+    save(filepathin, parametersin)
+    with open(filepathsweep, "w") as fid:
+        json.dump({"threads": threads, "parameters": sweep, "reference": reference}, fid, indent=4)
+
+    # Run sweep
+    subprocess.run([command, "--sweep", filepathin, filepathsweep, batchpath], check=True)
+
+    # Load completed cases from the summary
+    parametersout = []
+    with open(os.path.join(batchpath, "sweep.jsonl"), "r") as fid:
+        for line in fid:
+            entry = json.loads(line)
+            if entry["status"] == "completed": parametersout.append(load(os.path.join(batchpath, entry["file"])))
+
     # Return output
     return parametersout
\ No newline at end of file
@@ -86,13 +86,46 @@ PROPAGATORPARAMETERS_DEFAULT = {
     "timeStepIntermediate": [30],
     "timeStep": [30],
     "absoluteTolerance": [1e-14],
-    "relativeTolerance": [1e-14]
+    "relativeTolerance": [1e-14],
+    "ensembleSize": [0],
+    "isMixedPrecision": [False],
+    "evaluationThreads": [0],
+    "events": [[]],
+    "chunkSize": [0],
+    "stateTransitionMatrix": [""],
+    "covarianceMethod": [""],
+    "unscentedAlpha": [1.0],
+    "unscentedBeta": [2.0],
+    "unscentedKappa": [0.0],
+    "unscentedThreads": [0],
+    "precision": [""]
 }
 
 POLYNOMIALPARAMETERS_DEFAULT = {
     "isEnabled": [False],
     "type": [""],
-    "maxDegree": [0]
+    "maxDegree": [0],
+    "coefficientThreshold": [0.0],
+    "splitThreshold": [0.0],
+    "maxSplitDepth": [0],
+    "flowMapOutput": [""],
+    "flowMapInput": [""],
+    "flowMapMargin": [0.0]
+}
+
+PROFILINGPARAMETERS_DEFAULT = {
+    "isEnabled": [False],
+    "perturbationSampling": [0],
+    "traceOutput": [""]
+}
+
+SAMPLINGPARAMETERS_DEFAULT = {
+    "method": [""],
+    "count": [0],
+    "lowerBound": [[]],
+    "upperBound": [[]],
+    "seed": [0],
+    "threads": [0]
 }
 
 STATEPARAMETERS_DEFAULT = {
@@ -100,11 +133,16 @@ STATEPARAMETERS_DEFAULT = {
     "states": [
         [[7000.0, 0.0, 0.0, 0.0, 8.0, 0.0]]
     ],
-    "statetype": ["Cartesian"]
+    "statetype": ["Cartesian"],
+    "file": [""],
+    "stms": [[]],
+    "covariance": [[]],
+    "sampling": dataclass_permutations(SamplingParameters, SAMPLINGPARAMETERS_DEFAULT)
 }
 
 EXECUTIONSTATISTICS_DEFAULT = {
-    "propagationTime": [0.0]
+    "propagationTime": [0.0],
+    "timers": [[]]
 }
 
 PARAMETERS_DEFAULT = {
@@ -113,6 +151,8 @@ PARAMETERS_DEFAULT = {
     "perturbation": dataclass_permutations(PerturbationParameters, PERTURBATIONPARAMETERS_DEFAULT),
     "propagator": dataclass_permutations(PropagatorParameters, PROPAGATORPARAMETERS_DEFAULT),
     "polynomial": dataclass_permutations(PolynomialParameters, POLYNOMIALPARAMETERS_DEFAULT),
+    "profiling": dataclass_permutations(ProfilingParameters, PROFILINGPARAMETERS_DEFAULT),
     "states": [dataclass_permutations(StateParameters, STATEPARAMETERS_DEFAULT)],
+    "events": [[]],
     "statistics": dataclass_permutations(ExecutionStatistics, EXECUTIONSTATISTICS_DEFAULT)
 }
\ No newline at end of file
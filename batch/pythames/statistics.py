@@ -23,6 +23,7 @@
 # SOFTWARE.
 
 import dataclasses
+import os
 from typing import List
 
 import numpy as np
@@ -77,4 +78,8 @@ def bulk_statistics(parameters: List[Parameters]) -> pd.DataFrame:
     param_df["rsw_dom"] = param_df["rsw_mean"].apply(lambda x: np.argmax(np.abs(x)))
 
     # Return bulk statistics
-    return param_df
\ No newline at end of file
+    return param_df
+
+def sweep_statistics(batchpath: str) -> pd.DataFrame:
+    # Load error statistics streamed by a sweep with a reference run
+    return pd.read_csv(os.path.join(batchpath, "statistics.csv"))
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_IO_BINARY
+#define THAMES_IO_BINARY
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace thames::io::binary {
+
+    /**
+     * @brief Read-only memory map of a binary state file.
+     * 
+     * Supports NumPy (.npy) files of little-endian 64-bit floats in C order with shape (number of states, state dimension), and raw files of row-major little-endian 64-bit floats. The file is never parsed into memory: states are copied out of the map on request, and pages which have been read are released so that the resident memory remains bounded.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class StateFileReader {
+
+        protected:
+
+            /// File descriptor
+            int m_file = -1;
+
+            /// Mapped memory
+            void* m_map = nullptr;
+
+            /// Size of the mapped memory
+            std::size_t m_mapSize = 0;
+
+            /// Offset of the state data from the start of the file
+            std::size_t m_offset = 0;
+
+            /// Number of states
+            std::size_t m_size = 0;
+
+            /// State dimension
+            std::size_t m_dimension = 0;
+
+        public:
+
+            /**
+             * @brief Construct a new State File Reader object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] filepath Path to the state file.
+             * @param[in] dimension State dimension.
+             */
+            StateFileReader(const std::string& filepath, const std::size_t dimension = 6);
+
+            /**
+             * @brief Destroy the State File Reader object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~StateFileReader();
+
+            StateFileReader(const StateFileReader&) = delete;
+            StateFileReader& operator=(const StateFileReader&) = delete;
+
+            /**
+             * @brief Get the number of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::size_t Number of states.
+             */
+            std::size_t size() const;
+
+            /**
+             * @brief Read a contiguous range of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] start Index of the first state.
+             * @param[in] count Number of states.
+             * @return std::vector<std::vector<T>> States.
+             */
+            std::vector<std::vector<T>> read(const std::size_t start, const std::size_t count) const;
+
+    };
+
+    /**
+     * @brief Writable memory map of a NumPy (.npy) state file.
+     * 
+     * The file is created with its final size on construction, and states are written directly into the map. Pages which have been written are released to the operating system for write-back so that the resident memory remains bounded.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class StateFileWriter {
+
+        protected:
+
+            /// File descriptor
+            int m_file = -1;
+
+            /// Mapped memory
+            void* m_map = nullptr;
+
+            /// Size of the mapped memory
+            std::size_t m_mapSize = 0;
+
+            /// Offset of the state data from the start of the file
+            std::size_t m_offset = 0;
+
+            /// Number of states
+            std::size_t m_size = 0;
+
+            /// State dimension
+            std::size_t m_dimension = 0;
+
+        public:
+
+            /**
+             * @brief Construct a new State File Writer object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] filepath Path to the state file.
+             * @param[in] size Number of states.
+             * @param[in] dimension State dimension.
+             */
+            StateFileWriter(const std::string& filepath, const std::size_t size, const std::size_t dimension = 6);
+
+            /**
+             * @brief Destroy the State File Writer object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~StateFileWriter();
+
+            StateFileWriter(const StateFileWriter&) = delete;
+            StateFileWriter& operator=(const StateFileWriter&) = delete;
+
+            /**
+             * @brief Write a contiguous range of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] start Index of the first state.
+             * @param[in] states States.
+             */
+            void write(const std::size_t start, const std::vector<std::vector<T>>& states);
+
+    };
+
+}
+
+#endif
\ No newline at end of file
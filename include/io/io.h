@@ -25,6 +25,7 @@ SOFTWARE.
 #ifndef THAMES_IO
 #define THAMES_IO
 
+#include "binary.h"
 #include "json.h"
 
 #endif
\ No newline at end of file
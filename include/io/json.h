@@ -25,6 +25,7 @@ SOFTWARE.
 #ifndef THAMES_IO_JSON
 #define THAMES_IO_JSON
 
+#include "../propagators/flowmap.h"
 #include "../settings/settings.h"
 
 namespace thames::io::json {
@@ -55,6 +56,83 @@ namespace thames::io::json {
     template<class T>
     void save(const std::string& filepath, thames::settings::Parameters<T> parameters);
 
+    /**
+     * @brief Load flow map from JSON
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     * @param[in] filepath Input file path
+     * @param[out] map Flow map
+     */
+    template<class T>
+    void load(const std::string& filepath, thames::propagators::flowmap::FlowMap<T>& map);
+
+    /**
+     * @brief Save flow map to JSON
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     * @param[in] filepath Output file path
+     * @param[in] map Flow map
+     */
+    template<class T>
+    void save(const std::string& filepath, const thames::propagators::flowmap::FlowMap<T>& map);
+
+    /**
+     * @brief Load sweep parameters from JSON
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] filepath Input file path
+     * @param[out] sweep Sweep parameters
+     */
+    void load(const std::string& filepath, thames::settings::SweepParameters& sweep);
+
+    /**
+     * @brief Calculate the number of cases in a sweep
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] sweep Sweep parameters
+     * @return std::size_t Number of cases
+     */
+    std::size_t sweep_size(const thames::settings::SweepParameters& sweep);
+
+    /**
+     * @brief Generate the parameter values of a case in a sweep
+     * 
+     * Cases are ordered with the last swept parameter varying fastest.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] sweep Sweep parameters
+     * @param[in] index Case index
+     * @return nlohmann::json Parameter values, keyed by dotted path
+     */
+    nlohmann::json sweep_case(const thames::settings::SweepParameters& sweep, const std::size_t index);
+
+    /**
+     * @brief Apply parameter values, keyed by dotted path, to parameters
+     * 
+     * @note State parameters cannot be overridden, and are not serialised when applying values.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     * @param[in,out] parameters Parameters
+     * @param[in] values Parameter values, keyed by dotted path
+     */
+    template<class T>
+    void apply_values(thames::settings::Parameters<T>& parameters, const nlohmann::json& values);
+
 }
 
 #endif
\ No newline at end of file
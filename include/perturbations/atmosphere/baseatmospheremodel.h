@@ -77,6 +77,17 @@ namespace thames::perturbations::atmosphere::models {
              */
             virtual T density(T alt) const;
 
+            /**
+             * @brief Calculate derivative of the density with respect to the altitude
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] alt Altitude
+             * @return T Derivative of the density
+             */
+            virtual T density_gradient(T alt) const;
+
     };
 
     /////////////////
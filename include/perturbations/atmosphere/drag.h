@@ -48,12 +48,6 @@ namespace thames::perturbations::atmosphere::drag {
 
         private:
 
-            /// Dimensional factors
-            using BasePerturbation<T>::m_factors;
-
-            /// Non-dimensional flag
-            using BasePerturbation<T>::m_isNonDimensional;
-
             /// Central body radius
             const T m_radius;
 
@@ -72,6 +66,12 @@ namespace thames::perturbations::atmosphere::drag {
             /// Atmosphere model
             const std::shared_ptr<const BaseAtmosphereModel<T>> m_model;
 
+            /// Length unit of positions and central body radius (in km)
+            const T m_length;
+
+            /// Drag factor (-0.5*Cd*A/m, including conversion of density to kg/km^3)
+            const T m_dragFactor;
+
         public:
 
             /**
@@ -86,9 +86,9 @@ namespace thames::perturbations::atmosphere::drag {
              * @param[in] A Spacecraft drag area.
              * @param[in] m Spacecraft mass.
              * @param[in] model Atmosphere model.
-             * @param[in] factors Dimensional factors.
+             * @param[in] length Length unit of positions and central body radius (in km).
              */
-            Drag(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModel<T>> model, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            Drag(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModel<T>> model, const T& length = 1.0);
 
             /**
              * @brief Destroy the Drag object.
@@ -99,6 +99,19 @@ namespace thames::perturbations::atmosphere::drag {
              */
             ~Drag();
 
+            /**
+             * @brief Create a non-dimensional copy of the drag perturbation.
+             * 
+             * The spacecraft mass is scaled by the cube of the length factor, so that the atmospheric density (in kg/km^3) is non-dimensionalised through the mass ratio.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] factors Dimensional factors.
+             * @return std::shared_ptr<BasePerturbation<T>> Non-dimensional drag perturbation.
+             */
+            std::shared_ptr<BasePerturbation<T>> nondimensionalise(const DimensionalFactors<T>& factors) const override;
+
             /**
              * @brief Calculate perturbing acceleration resulting from drag. 
              * 
@@ -125,6 +138,31 @@ namespace thames::perturbations::atmosphere::drag {
              */
             std::vector<T> acceleration_nonpotential(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
 
+            /**
+             * @brief Calculate Jacobian of the perturbing acceleration resulting from drag.
+             * 
+             * Includes the gradient of the density with respect to the altitude from the atmosphere model.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] R Position vector.
+             * @param[in] V Velocity vector.
+             * @return std::vector<T> Partial derivatives of the acceleration with respect to the position and velocity (3x6, row-major).
+             */
+            std::vector<T> jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
+
+            /**
+             * @brief Get the name of the drag perturbation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::string Perturbation name.
+             */
+            std::string name() const override;
+
     };
 
     #ifdef THAMES_USE_SMARTUQ
@@ -146,12 +184,6 @@ namespace thames::perturbations::atmosphere::drag {
 
         private:
 
-            /// Dimensional factors
-            using BasePerturbationPolynomial<T, P>::m_factors;
-
-            /// Non-dimensional flag
-            using BasePerturbationPolynomial<T, P>::m_isNonDimensional;
-
             /// Central body radius
             const T m_radius;
 
@@ -170,6 +202,12 @@ namespace thames::perturbations::atmosphere::drag {
             /// Atmosphere model
             const std::shared_ptr<const BaseAtmosphereModelPolynomial<T, P>> m_model;
 
+            /// Length unit of positions and central body radius (in km)
+            const T m_length;
+
+            /// Drag factor (-0.5*Cd*A/m, including conversion of density to kg/km^3)
+            const T m_dragFactor;
+
         public:
 
             /**
@@ -184,9 +222,9 @@ namespace thames::perturbations::atmosphere::drag {
              * @param[in] A Spacecraft drag area.
              * @param[in] m Spacecraft mass.
              * @param[in] model Atmosphere model.
-             * @param[in] factors Dimensional factors.
+             * @param[in] length Length unit of positions and central body radius (in km).
              */
-            DragPolynomial(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModelPolynomial<T, P>> model, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            DragPolynomial(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModelPolynomial<T, P>> model, const T& length = 1.0);
 
             /**
              * @brief Destroy the Drag object for use with polynomials.
@@ -197,6 +235,19 @@ namespace thames::perturbations::atmosphere::drag {
              */
             ~DragPolynomial();
 
+            /**
+             * @brief Create a non-dimensional copy of the drag perturbation.
+             * 
+             * The spacecraft mass is scaled by the cube of the length factor, so that the atmospheric density (in kg/km^3) is non-dimensionalised through the mass ratio.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] factors Dimensional factors.
+             * @return std::shared_ptr<BasePerturbationPolynomial<T, P>> Non-dimensional drag perturbation.
+             */
+            std::shared_ptr<BasePerturbationPolynomial<T, P>> nondimensionalise(const DimensionalFactors<T>& factors) const override;
+
             /**
              * @brief Calculate perturbing acceleration resulting from drag. 
              * 
@@ -70,6 +70,17 @@ namespace thames::perturbations::atmosphere::models {
                 60.828, 63.822, 71.835, 88.667, 124.640, 181.050, 268.000
             };
 
+            /**
+             * @brief Determine the interpolation interval of an altitude
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] alt Altitude [km]
+             * @return std::size_t Index of the interval
+             */
+            std::size_t interval(const T alt) const;
+
         public:
 
             /**
@@ -96,6 +107,17 @@ namespace thames::perturbations::atmosphere::models {
              */
             T density(T alt) const override;
 
+            /**
+             * @brief Calculate derivative of the density with respect to the altitude
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] alt Altitude [km]
+             * @return T Derivative of the density [kg/m^3/km]
+             */
+            T density_gradient(T alt) const override;
+
     };
 
     /////////////////
@@ -81,6 +81,17 @@ namespace thames::perturbations::atmosphere::models {
              */
             T density(T alt) const override;
 
+            /**
+             * @brief Calculate derivative of the density with respect to the altitude
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] alt Altitude [km]
+             * @return T Derivative of the density [kg/m^3/km]
+             */
+            T density_gradient(T alt) const override;
+
     };
 
     /////////////////
@@ -27,6 +27,7 @@ SOFTWARE.
 
 #include <array>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "../conversions/dimensional.h"
@@ -50,14 +51,6 @@ namespace thames::perturbations::baseperturbation{
     template<class T>
     class BasePerturbation{
 
-        protected:
-
-            /// Dimensional factors
-            const std::shared_ptr<const DimensionalFactors<T>> m_factors;
-
-            /// Flag for whether to expect non-dimensional inputs/outputs
-            bool m_isNonDimensional = false;
-
         public:
 
             /**
@@ -66,10 +59,8 @@ namespace thames::perturbations::baseperturbation{
              * @author Max Hallgarten La Casta
              * @date 2022-05-27
              * 
-             * @param[in] factors Factors for non-dimensionalisation.
-             * 
              */
-            BasePerturbation(const std::shared_ptr<const DimensionalFactors<T>> factors);
+            BasePerturbation();
 
             /**
              * @brief Destroy the Base Perturbation object.
@@ -81,24 +72,17 @@ namespace thames::perturbations::baseperturbation{
             ~BasePerturbation();
 
             /**
-             * @brief Get the non-dimensional flag.
+             * @brief Create a non-dimensional copy of the perturbation.
              * 
-             * @author Max Hallgarten La Casta
-             * @date 2022-05-19
-             * 
-             * @return bool
-             */
-            bool get_nondimensional();
-
-            /**
-             * @brief Set the non-dimensional flag.
+             * Perturbation objects are immutable after construction, therefore constants are pre-scaled into a new object for non-dimensional propagation. The default perturbation has no constants, and is copied unchanged.
              * 
              * @author Max Hallgarten La Casta
-             * @date 2022-05-20
+             * @date 2026-10-19
              * 
-             * @param[in] isNonDimensional Non-dimensional flag.
+             * @param[in] factors Factors for non-dimensionalisation.
+             * @return std::shared_ptr<BasePerturbation<T>> Non-dimensional perturbation.
              */
-            virtual void set_nondimensional(const bool isNonDimensional);
+            virtual std::shared_ptr<BasePerturbation<T>> nondimensionalise(const DimensionalFactors<T>& factors) const;
 
             /**
              * @brief Default total perturbing acceleration.
@@ -115,6 +99,21 @@ namespace thames::perturbations::baseperturbation{
              */
             virtual std::vector<T> acceleration_total(const T& t, const std::vector<T>& R, const std::vector<T>& V) const;
 
+            /**
+             * @brief Default total perturbing acceleration for an ensemble of states.
+             * 
+             * Adds the total perturbing acceleration of each ensemble member, evaluated individually with acceleration_total.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Ensemble Cartesian states, stored component-wise (i.e. all x, then all y, etc.).
+             * @param[in,out] A Ensemble accelerations, stored component-wise, to which the perturbing accelerations are added.
+             * @param[in] n Number of ensemble members.
+             */
+            virtual void acceleration_total_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const;
+
             /**
              * @brief Default non-potential perturbing acceleration.
              * 
@@ -130,6 +129,21 @@ namespace thames::perturbations::baseperturbation{
              */
             virtual std::vector<T> acceleration_nonpotential(const T& t, const std::vector<T>& R, const std::vector<T>& V) const;
 
+            /**
+             * @brief Default non-potential perturbing acceleration for an ensemble of states.
+             * 
+             * Adds the non-potential perturbing acceleration of each ensemble member, evaluated individually with acceleration_nonpotential.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Ensemble Cartesian states, stored component-wise (i.e. all x, then all y, etc.).
+             * @param[in,out] A Ensemble accelerations, stored component-wise, to which the non-potential perturbing accelerations are added.
+             * @param[in] n Number of ensemble members.
+             */
+            virtual void acceleration_nonpotential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const;
+
             /**
              * @brief Default perturbing potential.
              * 
@@ -144,6 +158,21 @@ namespace thames::perturbations::baseperturbation{
              */
             virtual T potential(const T& t, const std::vector<T>& R) const;
 
+            /**
+             * @brief Default perturbing potential for an ensemble of states.
+             * 
+             * Adds the perturbing potential of each ensemble member, evaluated individually with potential.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Ensemble Cartesian states, stored component-wise. Only the positions are used.
+             * @param[in,out] U Ensemble perturbing potentials, to which the perturbing potentials are added.
+             * @param[in] n Number of ensemble members.
+             */
+            virtual void potential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& U, const std::size_t n) const;
+
             /**
              * @brief Default time derivative of the perturbing potential.
              * 
@@ -159,6 +188,46 @@ namespace thames::perturbations::baseperturbation{
              */
             virtual T potential_derivative(const T& t, const std::vector<T>& R, const std::vector<T>& V) const;
 
+            /**
+             * @brief Default time derivative of the perturbing potential for an ensemble of states.
+             * 
+             * Adds the time derivative of the perturbing potential of each ensemble member, evaluated individually with potential_derivative.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Ensemble Cartesian states, stored component-wise.
+             * @param[in,out] Ut Ensemble time derivatives of the perturbing potential, to which the time derivatives are added.
+             * @param[in] n Number of ensemble members.
+             */
+            virtual void potential_derivative_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& Ut, const std::size_t n) const;
+
+            /**
+             * @brief Default Jacobian of the total perturbing acceleration.
+             * 
+             * Calculates the Jacobian by central differences of the total perturbing acceleration, so that models without an analytical Jacobian remain supported.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] R Position vector.
+             * @param[in] V Velocity vector.
+             * @return std::vector<T> Partial derivatives of the acceleration with respect to the position and velocity (3x6, row-major).
+             */
+            virtual std::vector<T> jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const;
+
+            /**
+             * @brief Get the name of the perturbation, used to label profiling records.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::string Perturbation name.
+             */
+            virtual std::string name() const;
+
     };
 
     /////////////////
@@ -179,14 +248,6 @@ namespace thames::perturbations::baseperturbation{
     template<class T, template<class> class P>
     class BasePerturbationPolynomial{
 
-        protected:
-
-            /// Dimensional factors
-            const std::shared_ptr<const DimensionalFactors<T>> m_factors;
-
-            /// Flag for whether to expect non-dimensional inputs/outputs
-            bool m_isNonDimensional = false;
-
         public:
 
             /**
@@ -195,10 +256,8 @@ namespace thames::perturbations::baseperturbation{
              * @author Max Hallgarten La Casta
              * @date 2022-05-27
              * 
-             * @param[in] factors Factors for non-dimensionalisation.
-             * 
              */
-            BasePerturbationPolynomial(const std::shared_ptr<const DimensionalFactors<T>> factors);
+            BasePerturbationPolynomial();
 
             /**
              * @brief Destroy the Base Perturbation Polynomial object.
@@ -210,24 +269,17 @@ namespace thames::perturbations::baseperturbation{
             ~BasePerturbationPolynomial();
 
             /**
-             * @brief Get the non-dimensional flag.
-             * 
-             * @author Max Hallgarten La Casta
-             * @date 2022-05-11
+             * @brief Create a non-dimensional copy of the perturbation.
              * 
-             * @return bool
-             */
-            virtual bool get_nondimensional();
-
-            /**
-             * @brief Set the non-dimensional flag.
+             * Perturbation objects are immutable after construction, therefore constants are pre-scaled into a new object for non-dimensional propagation. The default perturbation has no constants, and is copied unchanged.
              * 
              * @author Max Hallgarten La Casta
-             * @date 2022-05-11
+             * @date 2026-10-19
              * 
-             * @param isNonDimensional Non-dimensional flag.
+             * @param[in] factors Factors for non-dimensionalisation.
+             * @return std::shared_ptr<BasePerturbationPolynomial<T, P>> Non-dimensional perturbation.
              */
-            virtual void set_nondimensional(bool isNonDimensional);
+            virtual std::shared_ptr<BasePerturbationPolynomial<T, P>> nondimensionalise(const DimensionalFactors<T>& factors) const;
 
             /**
              * @brief Default total perturbing acceleration.
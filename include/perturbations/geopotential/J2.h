@@ -26,6 +26,7 @@ SOFTWARE.
 #define THAMES_PERTURBATIONS_GEOPOTENTIAL_J2
 
 #include <array>
+#include <string>
 #include <vector>
 
 #include "../baseperturbation.h"
@@ -53,12 +54,6 @@ namespace thames::perturbations::geopotential{
 
         private:
 
-            /// Dimensional factors
-            using BasePerturbation<T>::m_factors;
-
-            /// Non-dimensional flag
-            using BasePerturbation<T>::m_isNonDimensional;
-
             /// Central body gravitational parameter
             const T m_mu;
 
@@ -68,6 +63,12 @@ namespace thames::perturbations::geopotential{
             /// Central body radius
             const T m_radius;
 
+            /// Acceleration factor (-1.5*mu*J2*radius^2)
+            const T m_accelerationFactor;
+
+            /// Potential factor (0.5*mu*J2*radius^2)
+            const T m_potentialFactor;
+
         public:
 
             /**
@@ -79,9 +80,8 @@ namespace thames::perturbations::geopotential{
              * @param[in] mu Central body gravitational parameter.
              * @param[in] J2 Central body J2-term.
              * @param[in] radius Central body radius.
-             * @param[in] factors Dimensional factors.
              */
-            J2(const T& mu, const T& J2, const T& radius, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            J2(const T& mu, const T& J2, const T& radius);
 
             /**
              * @brief Destroy the J2 object.
@@ -92,6 +92,17 @@ namespace thames::perturbations::geopotential{
              */
             ~J2();
 
+            /**
+             * @brief Create a non-dimensional copy of the J2 perturbation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] factors Dimensional factors.
+             * @return std::shared_ptr<BasePerturbation<T>> Non-dimensional J2 perturbation.
+             */
+            std::shared_ptr<BasePerturbation<T>> nondimensionalise(const DimensionalFactors<T>& factors) const override;
+
             /**
              * @brief Calculate perturbing acceleration resulting from the J2-term. 
              * 
@@ -105,6 +116,19 @@ namespace thames::perturbations::geopotential{
              */
             std::vector<T> acceleration_total(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
 
+            /**
+             * @brief Calculate perturbing acceleration resulting from the J2-term for an ensemble of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Ensemble Cartesian states, stored component-wise.
+             * @param[in,out] A Ensemble accelerations, stored component-wise, to which the perturbing accelerations are added.
+             * @param[in] n Number of ensemble members.
+             */
+            void acceleration_total_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const override;
+
             /**
              * @brief Calculate perturbing potential resulting from the J2-term. 
              * 
@@ -117,6 +141,42 @@ namespace thames::perturbations::geopotential{
              */
             T potential(const T& t, const std::vector<T>& R) const override;
 
+            /**
+             * @brief Calculate perturbing potential resulting from the J2-term for an ensemble of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Ensemble Cartesian states, stored component-wise.
+             * @param[in,out] U Ensemble perturbing potentials, to which the perturbing potentials are added.
+             * @param[in] n Number of ensemble members.
+             */
+            void potential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& U, const std::size_t n) const override;
+
+            /**
+             * @brief Calculate Jacobian of the perturbing acceleration resulting from the J2-term.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] R Position vector.
+             * @param[in] V Velocity vector.
+             * @return std::vector<T> Partial derivatives of the acceleration with respect to the position and velocity (3x6, row-major).
+             */
+            std::vector<T> jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
+
+            /**
+             * @brief Get the name of the J2-term perturbation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::string Perturbation name.
+             */
+            std::string name() const override;
+
     };
 
     /////////////////
@@ -141,12 +201,6 @@ namespace thames::perturbations::geopotential{
         
         private:
 
-            /// Dimensional factors
-            using BasePerturbationPolynomial<T, P>::m_factors;
-
-            /// Non-dimensional flag
-            using BasePerturbationPolynomial<T, P>::m_isNonDimensional;
-
             /// Central body gravitational parameter
             const T m_mu;       
 
@@ -156,6 +210,12 @@ namespace thames::perturbations::geopotential{
             /// Central body radius
             const T m_radius;
 
+            /// Acceleration factor (-1.5*mu*J2*radius^2)
+            const T m_accelerationFactor;
+
+            /// Potential factor (0.5*mu*J2*radius^2)
+            const T m_potentialFactor;
+
         public:
 
             /**
@@ -167,9 +227,8 @@ namespace thames::perturbations::geopotential{
              * @param[in] mu Central body gravitational parameter.
              * @param[in] J2 Central body J2-term.
              * @param[in] radius Central body radius.
-             * @param[in] factors Dimensional factors.
              */
-            J2Polynomial(const T& mu, const T& J2, const T& radius, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            J2Polynomial(const T& mu, const T& J2, const T& radius);
 
             /**
              * @brief Destroy the J2Polynomial object
@@ -180,6 +239,17 @@ namespace thames::perturbations::geopotential{
              */
             ~J2Polynomial();
 
+            /**
+             * @brief Create a non-dimensional copy of the J2 perturbation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] factors Dimensional factors.
+             * @return std::shared_ptr<BasePerturbationPolynomial<T, P>> Non-dimensional J2 perturbation.
+             */
+            std::shared_ptr<BasePerturbationPolynomial<T, P>> nondimensionalise(const DimensionalFactors<T>& factors) const override;
+
             /**
              * @brief Calculate perturbing acceleration resulting from the J2-term. 
              * 
@@ -26,6 +26,7 @@ SOFTWARE.
 #define THAMES_PERTURBATIONS_PERTURBATIONCOMBINER
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "baseperturbation.h"
@@ -48,12 +49,6 @@ namespace thames::perturbations::perturbationcombiner {
 
         private:
 
-            /// Dimensional factors
-            using BasePerturbation<T>::m_factors;
-
-            /// Non-dimensional flag
-            using BasePerturbation<T>::m_isNonDimensional;
-
             /// Underlying perturbation models
             std::vector<std::shared_ptr<BasePerturbation<T>>> m_models;
 
@@ -65,9 +60,8 @@ namespace thames::perturbations::perturbationcombiner {
              * @author Max Hallgarten La Casta
              * @date 2022-05-27
              * 
-             * @param[in] factors Dimensional factors
              */
-            PerturbationCombiner(const std::shared_ptr<const DimensionalFactors<T>> factors);
+            PerturbationCombiner();
 
             /**
              * @brief Construct a new Perturbation Combiner object
@@ -76,9 +70,8 @@ namespace thames::perturbations::perturbationcombiner {
              * @date 2022-05-27
              * 
              * @param[in] models Perturbation models
-             * @param[in] factors Dimensional factors
              */
-            PerturbationCombiner(const std::vector<std::shared_ptr<BasePerturbation<T>>>& models, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            PerturbationCombiner(const std::vector<std::shared_ptr<BasePerturbation<T>>>& models);
 
             /**
              * @brief Destroy the Perturbation Combiner object
@@ -89,14 +82,15 @@ namespace thames::perturbations::perturbationcombiner {
             ~PerturbationCombiner();
 
             /**
-             * @brief Set the non-dimensional flag
+             * @brief Create a non-dimensional copy of the combiner, including copies of the underlying models
              * 
              * @author Max Hallgarten La Casta
-             * @date 2022-05-20
+             * @date 2026-10-19
              * 
-             * @param[in] isNonDimensional Non-dimensional flag
+             * @param[in] factors Dimensional factors
+             * @return std::shared_ptr<BasePerturbation<T>> Non-dimensional perturbation combiner
              */
-            void set_nondimensional(const bool isNonDimensional) override;
+            std::shared_ptr<BasePerturbation<T>> nondimensionalise(const DimensionalFactors<T>& factors) const override;
 
             /**
              * @brief Add perturbation model to combiner
@@ -121,6 +115,19 @@ namespace thames::perturbations::perturbationcombiner {
              */
             std::vector<T> acceleration_total(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
 
+            /**
+             * @brief Total perturbing acceleration for an ensemble of states
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time
+             * @param[in] RV Ensemble Cartesian states, stored component-wise
+             * @param[in,out] A Ensemble accelerations, stored component-wise, to which the perturbing accelerations are added
+             * @param[in] n Number of ensemble members
+             */
+            void acceleration_total_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const override;
+
             /**
              * @brief Non-potential perturbing acceleration
              * 
@@ -134,6 +141,19 @@ namespace thames::perturbations::perturbationcombiner {
              */
             std::vector<T> acceleration_nonpotential(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
 
+            /**
+             * @brief Non-potential perturbing acceleration for an ensemble of states
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time
+             * @param[in] RV Ensemble Cartesian states, stored component-wise
+             * @param[in,out] A Ensemble accelerations, stored component-wise, to which the non-potential perturbing accelerations are added
+             * @param[in] n Number of ensemble members
+             */
+            void acceleration_nonpotential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const override;
+
             /**
              * @brief Perturbing potential
              * 
@@ -146,6 +166,19 @@ namespace thames::perturbations::perturbationcombiner {
              */
             T potential(const T& t, const std::vector<T>& R) const override;
 
+            /**
+             * @brief Perturbing potential for an ensemble of states
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time
+             * @param[in] RV Ensemble Cartesian states, stored component-wise
+             * @param[in,out] U Ensemble perturbing potentials, to which the perturbing potentials are added
+             * @param[in] n Number of ensemble members
+             */
+            void potential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& U, const std::size_t n) const override;
+
             /**
              * @brief Time derivative of the perturbing potential
              * 
@@ -158,6 +191,42 @@ namespace thames::perturbations::perturbationcombiner {
              * @return T Time derivative of the perturbing potential
              */
             T potential_derivative(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
+
+            /**
+             * @brief Time derivative of the perturbing potential for an ensemble of states
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time
+             * @param[in] RV Ensemble Cartesian states, stored component-wise
+             * @param[in,out] Ut Ensemble time derivatives of the perturbing potential, to which the time derivatives are added
+             * @param[in] n Number of ensemble members
+             */
+            void potential_derivative_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& Ut, const std::size_t n) const override;
+
+            /**
+             * @brief Jacobian of the total perturbing acceleration
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time
+             * @param[in] R Position vector
+             * @param[in] V Velocity vector
+             * @return std::vector<T> Partial derivatives of the acceleration with respect to the position and velocity (3x6, row-major)
+             */
+            std::vector<T> jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const override;
+
+            /**
+             * @brief Get the name of the perturbation combiner
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::string Perturbation name
+             */
+            std::string name() const override;
         
     };
 
@@ -183,12 +252,6 @@ namespace thames::perturbations::perturbationcombiner {
 
         private:
 
-            /// Dimensional factors
-            using BasePerturbationPolynomial<T, P>::m_factors;
-
-            /// Non-dimensional flag
-            using BasePerturbationPolynomial<T, P>::m_isNonDimensional;
-
             /// Underlying perturbation models
             std::vector<std::shared_ptr<BasePerturbationPolynomial<T, P>>> m_models;
 
@@ -200,9 +263,8 @@ namespace thames::perturbations::perturbationcombiner {
              * @author Max Hallgarten La Casta
              * @date 2022-05-27
              * 
-             * @param[in] factors Dimensional factors
              */
-            PerturbationCombinerPolynomial(const std::shared_ptr<const DimensionalFactors<T>> factors);
+            PerturbationCombinerPolynomial();
 
             /**
              * @brief Construct a new Perturbation Combiner object
@@ -211,9 +273,8 @@ namespace thames::perturbations::perturbationcombiner {
              * @date 2022-05-27
              * 
              * @param[in] models Perturbation models
-             * @param[in] factors Dimensional factors
              */
-            PerturbationCombinerPolynomial(const std::vector<std::shared_ptr<BasePerturbationPolynomial<T, P>>>& models, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            PerturbationCombinerPolynomial(const std::vector<std::shared_ptr<BasePerturbationPolynomial<T, P>>>& models);
 
             /**
              * @brief Destroy the Perturbation Combiner object
@@ -224,14 +285,15 @@ namespace thames::perturbations::perturbationcombiner {
             ~PerturbationCombinerPolynomial();
 
             /**
-             * @brief Set the non-dimensional flag
+             * @brief Create a non-dimensional copy of the combiner, including copies of the underlying models
              * 
              * @author Max Hallgarten La Casta
-             * @date 2022-05-20
+             * @date 2026-10-19
              * 
-             * @param[in] isNonDimensional Non-dimensional flag
+             * @param[in] factors Dimensional factors
+             * @return std::shared_ptr<BasePerturbationPolynomial<T, P>> Non-dimensional perturbation combiner
              */
-            void set_nondimensional(const bool isNonDimensional) override;
+            std::shared_ptr<BasePerturbationPolynomial<T, P>> nondimensionalise(const DimensionalFactors<T>& factors) const override;
 
             /**
              * @brief Add perturbation model to combiner
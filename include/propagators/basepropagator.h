@@ -38,12 +38,16 @@ SOFTWARE.
 #include "../conversions/dimensional.h"
 #include "../perturbations/baseperturbation.h"
 #include "../settings/settings.h"
+#include "events.h"
+#include "flowmap.h"
 
 namespace thames::propagators::basepropagator {
 
     using thames::constants::statetypes::StateTypes;
     using thames::conversions::dimensional::DimensionalFactors;
     using thames::perturbations::baseperturbation::BasePerturbation;
+    using thames::propagators::events::BaseEvent;
+    using thames::propagators::events::EventOccurrence;
     using thames::settings::PropagatorParameters;
 
     ///////////
@@ -66,14 +70,8 @@ namespace thames::propagators::basepropagator {
             /// Gravitational parameter
             const T m_mu;
 
-            /// Perturbation object
-            const std::shared_ptr<BasePerturbation<T>> m_perturbation;
-
-            /// Dimensional factors
-            const std::shared_ptr<DimensionalFactors<T>> m_factors;
-
-            /// Flag for whether to propagate in non-dimensional form
-            bool m_isNonDimensional = false;
+            /// Perturbation object (dimensional)
+            const std::shared_ptr<const BasePerturbation<T>> m_perturbation;
 
             /// State type for propagation
             const StateTypes m_propstatetype;
@@ -88,10 +86,9 @@ namespace thames::propagators::basepropagator {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              * @param[in] propstatetype Type of state used during propagation.
              */
-            BasePropagator(const T& mu, const std::shared_ptr<BasePerturbation<T>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors, const StateTypes propstatetype);
+            BasePropagator(const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation, const StateTypes propstatetype);
 
             /**
              * @brief Destroy the Base Propagator object
@@ -111,8 +108,62 @@ namespace thames::propagators::basepropagator {
              * @param[in] x State.
              * @param[out] dxdt State derivative.
              * @param[in] t Time.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             */
+            virtual void derivative(const std::vector<T>& x, std::vector<T>& dxdt, const T t, const T mu, const BasePerturbation<T>& perturbation) const;
+
+            /**
+             * @brief State derivative method for an ensemble of states.
+             * 
+             * The default implementation evaluates the derivative of each ensemble member individually.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] x Ensemble states, stored component-wise (i.e. first component of all members, then second component, etc.).
+             * @param[out] dxdt Ensemble state derivatives, stored component-wise.
+             * @param[in] t Time.
+             * @param[in] n Number of ensemble members.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             */
+            virtual void derivative_ensemble(const std::vector<T>& x, std::vector<T>& dxdt, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const;
+
+            /**
+             * @brief Derivative method for the single-precision deviations of an ensemble from a nominal state.
+             * 
+             * The default implementation recombines the members with the nominal in full precision, and stores the differences between the member and nominal derivatives.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] x Nominal state.
+             * @param[in] dxdt Nominal state derivative.
+             * @param[in] dx Deviations of the members from the nominal, stored component-wise.
+             * @param[out] ddxdt Derivatives of the deviations, stored component-wise.
+             * @param[in] t Time.
+             * @param[in] n Number of ensemble members.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             */
+            virtual void derivative_deviations(const std::vector<T>& x, const std::vector<T>& dxdt, const std::vector<float>& dx, std::vector<float>& ddxdt, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const;
+
+            /**
+             * @brief State derivative method with variational equations.
+             * 
+             * The state is augmented with the state transition matrix of the Cartesian state (6x6, row-major), which evolves with the variational equations. The Jacobian of the equations of motion combines the analytical two-body Jacobian with the Jacobian of the perturbing acceleration, evaluated at the Cartesian state corresponding to the propagation state.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] x Augmented state.
+             * @param[out] dxdt Augmented state derivative.
+             * @param[in] t Time.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
              */
-            virtual void derivative(const std::vector<T>& x, std::vector<T>& dxdt, const T t) const;
+            void derivative_variational(const std::vector<T>& x, std::vector<T>& dxdt, const T t, const T mu, const std::shared_ptr<const BasePerturbation<T>>& perturbation) const;
 
             /**
              * @brief Propagation method.
@@ -133,7 +184,7 @@ namespace thames::propagators::basepropagator {
             /**
              * @brief Propagation method (with intermediate output).
              * 
-             * @note A separate propagation is called for each intermediate output interval, therefore any required state conversions occur multiple times.
+             * The state is kept in the units and coordinates of the propagation between output times, and only copies of it are converted for output.
              * 
              * @author Max Hallgarten La Casta
              * @date 2022-07-06
@@ -147,9 +198,30 @@ namespace thames::propagators::basepropagator {
              */
             std::vector<std::vector<T>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype);
 
+            /**
+             * @brief Propagation method with state transition matrix.
+             * 
+             * The state transition matrix is propagated with the variational equations alongside the state.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tstart Propagation start time in physical time.
+             * @param[in] tend Propagation end time in physical time.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] state Initial Cartesian state.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type (must be Cartesian).
+             * @param[in,out] stm State transition matrix (6x6, row-major), from the reference time to the start time on input, and to the end time on output.
+             * @return std::vector<T> Final state.
+             */
+            std::vector<T> propagate(T tstart, T tend, T tstep, std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<T>& stm);
+
             /**
              * @brief Propagation method for sets.
              * 
+             * @note If the ensemble size in the propagator options is greater than one, the states are ordered by range and propagated in ensembles of neighbouring states.
+             * 
              * @author Max Hallgarten La Casta
              * @date 2022-06-02
              * 
@@ -163,10 +235,44 @@ namespace thames::propagators::basepropagator {
              */
             std::vector<std::vector<T>> propagate(const T tstart, const T tend, const T tstep, const std::vector<std::vector<T>> state, const PropagatorParameters<T> options, const StateTypes statetype);
 
+            /**
+             * @brief Ensemble propagation method.
+             * 
+             * All states are integrated together with a common timestep. For variable-step propagation, the timestep is controlled by the worst-case error over the ensemble. For non-dimensional propagation, common factors are calculated from the mean Cartesian state of the ensemble at the start time.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @return std::vector<std::vector<std::vector<T>>> States at each time.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate_ensemble(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T> options, const StateTypes statetype);
+
+            /**
+             * @brief Mixed-precision ensemble propagation method.
+             * 
+             * The nominal, taken as the mean Cartesian state of the ensemble, is integrated in full precision, whilst the deviations of the members from it are integrated in single precision with a common timestep. The derivatives of the deviations are evaluated by derivative_deviations, and the members are recovered by recombining the nominal and deviations at each output time. For variable-step propagation, the timestep is controlled by the errors of the nominal and deviations.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @return std::vector<std::vector<std::vector<T>>> States at each time.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate_ensemble_mixed(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T> options, const StateTypes statetype);
+
             /**
              * @brief Propagation method for sets (with intermediate output).
              * 
-             * @note A separate propagation is called for each intermediate output interval, therefore any required state conversions occur multiple times.
+             * The state is kept in the units and coordinates of the propagation between output times, and only copies of it are converted for output.
              * 
              * @author Max Hallgarten La Casta
              * @date 2022-07-06
@@ -180,6 +286,82 @@ namespace thames::propagators::basepropagator {
              */
             std::vector<std::vector<std::vector<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> state, const PropagatorParameters<T> options, const StateTypes statetype);
 
+            /**
+             * @brief Propagation method for sets with state transition matrices (with intermediate output).
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial Cartesian states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type (must be Cartesian).
+             * @param[out] stms State transition matrices (6x6, row-major) from the first time, for each time and state.
+             * @return std::vector<std::vector<std::vector<T>>> Final state.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<std::vector<std::vector<T>>>& stms);
+
+            /**
+             * @brief Propagation method for a mean and covariance with the unscented transform (with intermediate output).
+             * 
+             * The 2n+1 sigma points of the scaled unscented transform are generated from the mean and covariance and propagated, and the mean and covariance are reconstructed from the propagated sigma points at each time.
+             * 
+             * @note If the number of unscented transform threads in the propagator options is greater than one, the sigma points are propagated individually across a thread pool. Otherwise, they are propagated as a set, in ensembles if enabled.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] mean Initial mean state.
+             * @param[in] covariance Initial covariance (row-major).
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @param[out] covariances Covariances (row-major) for each time.
+             * @return std::vector<std::vector<T>> Mean states for each time.
+             */
+            std::vector<std::vector<T>> propagate_unscented(const std::vector<T> tvec, const T tstep, const std::vector<T> mean, const std::vector<T> covariance, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<std::vector<T>>& covariances);
+
+            /**
+             * @brief Propagation method with event detection.
+             * 
+             * Event functions are evaluated at the end of each step, and sign changes are located on the dense output of the step with Brent's method applied to the event function, bracketed by its values at the ends of the step. Adaptive propagation uses the Dormand-Prince stepper with its continuous extension, and fixed steps are interpolated with the cubic Hermite polynomial through the states and derivatives at the ends of the step. Propagation stops at the first terminal event. Fixed-step propagation takes uniform steps which end exactly at the end time.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tstart Propagation start time in physical time.
+             * @param[in] tend Propagation end time in physical time.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] state Initial state.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @param[in] events Events.
+             * @param[in,out] occurrences Event occurrences, to which the detected occurrences are appended in time order.
+             * @return std::vector<T> Final state (or state at the terminal event).
+             */
+            std::vector<T> propagate(T tstart, T tend, T tstep, std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype, const std::vector<std::shared_ptr<const BaseEvent<T>>>& events, std::vector<EventOccurrence<T>>& occurrences);
+
+            /**
+             * @brief Propagation method for sets with event detection (with intermediate output).
+             * 
+             * @note States are propagated individually, regardless of the ensemble size in the propagator options. After a terminal event, the state at the event is held for the remaining output times.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @param[in] events Events.
+             * @param[in,out] occurrences Event occurrences, to which the detected occurrences are appended.
+             * @return std::vector<std::vector<std::vector<T>>> Final state.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const std::vector<std::shared_ptr<const BaseEvent<T>>>& events, std::vector<EventOccurrence<T>>& occurrences);
+
     };
 
     /////////////////
@@ -202,24 +384,16 @@ namespace thames::propagators::basepropagator {
     template<class T, template<class> class P>
     class BasePropagatorPolynomialDynamics : public smartuq::dynamics::base_dynamics<P<T>> {
 
-        public:
-
-            /// Flag for whether to propagate in non-dimensional form
-            bool m_isNonDimensional = false;
-
         protected:
 
             /// Dynamics name
             using smartuq::dynamics::base_dynamics<P<T>>::m_name;
 
-            /// Gravitational parameter
+            /// Gravitational parameter, in the units of the propagation
             const T m_mu;
 
-            /// Perturbation object
-            const std::shared_ptr<BasePerturbationPolynomial<T, P>> m_perturbation;
-
-            /// Dimensional factors
-            const std::shared_ptr<const DimensionalFactors<T>> m_factors;
+            /// Perturbation object, in the units of the propagation
+            const std::shared_ptr<const BasePerturbationPolynomial<T, P>> m_perturbation;
 
         public:
 
@@ -230,11 +404,10 @@ namespace thames::propagators::basepropagator {
              * @date 2022-05-27
              * 
              * @param[in] name Dynamics object name.
-             * @param[in] mu Gravitational parameter.
-             * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
              */
-            BasePropagatorPolynomialDynamics(std::string name, const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            BasePropagatorPolynomialDynamics(std::string name, const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation);
 
             /**
              * @brief Destroy the Base Propagator Polynomial Dynamics object.
@@ -277,18 +450,24 @@ namespace thames::propagators::basepropagator {
             /// Gravitational parameter
             const T m_mu;
 
-            /// Perturbation object
-            const std::shared_ptr<BasePerturbationPolynomial<T, P>> m_perturbation;
-
-            /// Dimensional factors
-            const std::shared_ptr<DimensionalFactors<T>> m_factors;
-
-            /// Dynamics object
-            const std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> m_dyn;
+            /// Perturbation object (dimensional)
+            const std::shared_ptr<const BasePerturbationPolynomial<T, P>> m_perturbation;
 
             /// State type for propagation
             const StateTypes m_propstatetype;
 
+            /**
+             * @brief Create the dynamics object for a propagation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             * @return std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> Dynamics object.
+             */
+            virtual std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> create_dynamics(const T mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) const;
+
         public:
 
             /**
@@ -299,11 +478,9 @@ namespace thames::propagators::basepropagator {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
-             * @param[in] dyn Dynamics object.
              * @param[in] propstatetype Type of state used during propagation.
              */
-            BasePropagatorPolynomial(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors, const std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> dyn, const StateTypes propstatetype);
+            BasePropagatorPolynomial(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation, const StateTypes propstatetype);
 
             /**
              * @brief Propagation method.
@@ -324,7 +501,7 @@ namespace thames::propagators::basepropagator {
             /**
              * @brief Propagation method (with intermediate output).
              * 
-             * @note A separate propagation is called for each intermediate output interval, therefore any required state conversions occur multiple times.
+             * The state is kept in the units and coordinates of the propagation between output times, and only copies of it are converted for output.
              * 
              * @author Max Hallgarten La Casta
              * @date 2022-11-04
@@ -338,6 +515,24 @@ namespace thames::propagators::basepropagator {
              */
             std::vector<std::vector<P<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<P<T>> state, const PropagatorParameters<T> options, const StateTypes statetype);
 
+            /**
+             * @brief Propagation method with state transition matrix, extracted from first-degree polynomials (with intermediate output).
+             * 
+             * The state is represented by first-degree Taylor polynomials with unit half-width in each variable, so that the linear coefficients of the propagated polynomials are the partial derivatives of the final state with respect to the initial state.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] state Initial Cartesian state.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type (must be Cartesian).
+             * @param[out] stms State transition matrices (6x6, row-major) from the first time, for each time.
+             * @return std::vector<std::vector<T>> Final state.
+             */
+            std::vector<std::vector<T>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<std::vector<T>>& stms);
+
             /**
              * @brief Propagation method for sets of points.
              * 
@@ -351,13 +546,18 @@ namespace thames::propagators::basepropagator {
              * @param[in] options Propagator options.
              * @param[in] statetype State type.
              * @param[in] degree Polynomial degree.
+             * @param[in] threshold Relative coefficient threshold for sparsification before sampling.
+             * @param[in] splitThreshold Nonlinearity indicator threshold for domain splitting (disabled if zero).
+             * @param[in] maxSplitDepth Maximum number of successive domain splits.
              * @return std::vector<std::vector<T>> Final state.
              */
-            std::vector<std::vector<T>> propagate(const T tstart, const T tend, const T tstep, std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree);
+            std::vector<std::vector<T>> propagate(const T tstart, const T tend, const T tstep, std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree, const T threshold = 0.0, const T splitThreshold = 0.0, const unsigned int maxSplitDepth = 0);
 
             /**
              * @brief Propagation method for sets of points (with intermediate output).
              * 
+             * If the nonlinearity indicator of the propagated polynomials exceeds the splitting threshold, the set is split in two along the variable contributing most to the highest-degree coefficients at the epoch where the threshold is crossed, and each half continues from that epoch with its own polynomials.
+             * 
              * @author Max Hallgarten La Casta
              * @date 2022-11-04
              * 
@@ -367,9 +567,81 @@ namespace thames::propagators::basepropagator {
              * @param[in] options Propagator options.
              * @param[in] statetype State type.
              * @param[in] degree Polynomial degree.
+             * @param[in] threshold Relative coefficient threshold for sparsification before sampling.
+             * @param[in] splitThreshold Nonlinearity indicator threshold for domain splitting (disabled if zero).
+             * @param[in] maxSplitDepth Maximum number of successive domain splits.
+             * @return std::vector<std::vector<std::vector<T>>> Final state.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree, const T threshold = 0.0, const T splitThreshold = 0.0, const unsigned int maxSplitDepth = 0);
+
+            /**
+             * @brief Propagation method for sets of points (with intermediate output and flow map output).
+             * 
+             * The propagated polynomials of each domain are appended to the flow map, so that further states within the domains can be evaluated without propagation. The flow map must either be empty, or have been generated with the same times and polynomial settings.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @param[in] degree Polynomial degree.
+             * @param[in] threshold Relative coefficient threshold for sparsification before sampling.
+             * @param[in] splitThreshold Nonlinearity indicator threshold for domain splitting (disabled if zero).
+             * @param[in] maxSplitDepth Maximum number of successive domain splits.
+             * @param[in,out] map Flow map.
+             * @return std::vector<std::vector<std::vector<T>>> Final state.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, const unsigned int maxSplitDepth, thames::propagators::flowmap::FlowMap<T>& map);
+
+        protected:
+
+            /**
+             * @brief Propagate a set of points with domain splitting (with intermediate output).
+             * 
+             * Each domain is propagated until the nonlinearity indicator crosses the splitting threshold. The states up to the previous epoch are kept, and the domain is split in two halves, which continue from the states at that epoch. The halves of each level of splitting are propagated in parallel on the shared thread pool.
+             * 
+             * @note When a flow map is stored, the halves are propagated from the first epoch instead, as flow map domains map the initial states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @param[in] degree Polynomial degree.
+             * @param[in] threshold Relative coefficient threshold for sparsification before sampling.
+             * @param[in] splitThreshold Nonlinearity indicator threshold for domain splitting (disabled if zero).
+             * @param[in] maxSplitDepth Maximum number of successive domain splits.
+             * @param[out] domains Flow map domains of the final partition, appended if not null.
+             * @return std::vector<std::vector<std::vector<T>>> Final state.
+             */
+            std::vector<std::vector<std::vector<T>>> propagate_split(const std::vector<T>& tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T>& options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, const unsigned int maxSplitDepth, std::vector<thames::propagators::flowmap::FlowMapDomain<T>>* domains);
+
+            /**
+             * @brief Propagate a set of points in a single polynomial domain (with intermediate output).
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] tvec Vector of physical propagation times.
+             * @param[in] tstep Initial timestep for propagation.
+             * @param[in] states Initial states.
+             * @param[in] options Propagator options.
+             * @param[in] statetype State type.
+             * @param[in] degree Polynomial degree.
+             * @param[in] threshold Relative coefficient threshold for sparsification before sampling.
+             * @param[in] splitThreshold Nonlinearity indicator threshold at which propagation stops (disabled if zero).
+             * @param[out] crossing Index of the epoch at which the threshold is crossed (number of epochs if not crossed). States are only output for the preceding epochs.
+             * @param[out] scores Contribution of each variable to the nonlinearity indicator at the crossing.
+             * @param[out] domain Flow map domain, if not null.
              * @return std::vector<std::vector<std::vector<T>>> Final state.
              */
-            std::vector<std::vector<std::vector<T>>> propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree);
+            std::vector<std::vector<std::vector<T>>> propagate_domain(const std::vector<T>& tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T>& options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, std::size_t& crossing, std::vector<T>& scores, thames::propagators::flowmap::FlowMapDomain<T>* domain = nullptr);
 
     };
 
@@ -64,15 +64,9 @@ namespace thames::propagators {
             /// Perturbation object
             using BasePropagator<T>::m_perturbation;
 
-            /// Dimensional factors
-            using BasePropagator<T>::m_factors;
-
             /// Gravitational parameter
             using BasePropagator<T>::m_mu;
 
-            /// Flag for whether to propagate in non-dimensional form
-            using BasePropagator<T>::m_isNonDimensional;
-
             /// State type for propagation
             using BasePropagator<T>::m_propstatetype;
 
@@ -86,9 +80,8 @@ namespace thames::propagators {
              * 
              * @param[in] mu Gravitational parameter. 
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              */
-            CowellPropagator(const T& mu, std::shared_ptr<BasePerturbation<T>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors);
+            CowellPropagator(const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation);
 
             /**
              * @brief State derivative for Cowell's method propagation.
@@ -99,8 +92,44 @@ namespace thames::propagators {
              * @param[in] RV Cartesian state.
              * @param[out] RVdot Time derivative of the Cartesian state.
              * @param[in] t Current physical time.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             */
+            void derivative(const std::vector<T>& RV, std::vector<T>& RVdot, const T t, const T mu, const BasePerturbation<T>& perturbation) const override;
+
+            /**
+             * @brief State derivative for Cowell's method propagation of an ensemble of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] RV Ensemble Cartesian states, stored component-wise.
+             * @param[out] RVdot Time derivative of the ensemble Cartesian states, stored component-wise.
+             * @param[in] t Current physical time.
+             * @param[in] n Number of ensemble members.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             */
+            void derivative_ensemble(const std::vector<T>& RV, std::vector<T>& RVdot, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const override;
+
+            /**
+             * @brief Derivative for Cowell's method propagation of the single-precision deviations of an ensemble from a nominal Cartesian state.
+             * 
+             * The deviations are evaluated in single precision, with Encke's formulation for the central body acceleration, and the perturbing acceleration linearised about the nominal with the perturbation Jacobian.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] RV Nominal Cartesian state.
+             * @param[in] RVdot Time derivative of the nominal Cartesian state.
+             * @param[in] dRV Deviations of the members from the nominal, stored component-wise.
+             * @param[out] dRVdot Time derivative of the deviations, stored component-wise.
+             * @param[in] t Current physical time.
+             * @param[in] n Number of ensemble members.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
              */
-            void derivative(const std::vector<T>& RV, std::vector<T>& RVdot, const T t) const override;
+            void derivative_deviations(const std::vector<T>& RV, const std::vector<T>& RVdot, const std::vector<float>& dRV, std::vector<float>& dRVdot, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const override;
 
     };
 
@@ -126,11 +155,6 @@ namespace thames::propagators {
     template<class T, template<class> class P>
     class CowellPropagatorPolynomialDynamics : public BasePropagatorPolynomialDynamics<T, P> {
 
-        public:
-
-            /// Flag for whether to propagate in non-dimensional form
-            using BasePropagatorPolynomialDynamics<T, P>::m_isNonDimensional;
-
         private:
 
             /// Gravitational parameter
@@ -139,9 +163,6 @@ namespace thames::propagators {
             /// Perturbation object
             using BasePropagatorPolynomialDynamics<T, P>::m_perturbation;
 
-            /// Dimensional factors
-            using BasePropagatorPolynomialDynamics<T, P>::m_factors;
-
         public:
 
             /**
@@ -152,9 +173,8 @@ namespace thames::propagators {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              */
-            CowellPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            CowellPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation);
 
             /**
              * @brief Destroy the Cowell Propagator Polynomial Dynamics object.
@@ -197,14 +217,22 @@ namespace thames::propagators {
             /// Perturbation object
             using BasePropagatorPolynomial<T, P>::m_perturbation;
 
-            /// Dimensional factors
-            using BasePropagatorPolynomial<T, P>::m_factors;
-
             /// Gravitational parameter
             using BasePropagatorPolynomial<T, P>::m_mu;
 
-            /// Dynamics object
-            using BasePropagatorPolynomial<T, P>::m_dyn;
+        protected:
+
+            /**
+             * @brief Create the Cowell's method dynamics object for a propagation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             * @return std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> Dynamics object.
+             */
+            std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> create_dynamics(const T mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) const override;
 
         public:
 
@@ -216,9 +244,8 @@ namespace thames::propagators {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              */
-            CowellPropagatorPolynomial(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors);
+            CowellPropagatorPolynomial(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation);
 
             /**
              * @brief Destroy the Cowell Propagator Polynomial object
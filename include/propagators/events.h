@@ -0,0 +1,309 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_PROPAGATORS_EVENTS
+#define THAMES_PROPAGATORS_EVENTS
+
+#include <vector>
+
+namespace thames::propagators::events {
+
+    ///////////
+    // Reals //
+    ///////////
+
+    /**
+     * @brief Structure to store an event occurrence.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    struct EventOccurrence {
+        /// Index of the event
+        std::size_t event;
+
+        /// Index of the state in the propagated set
+        std::size_t sample;
+
+        /// Physical time of the occurrence
+        T time;
+
+        /// State at the occurrence
+        std::vector<T> state;
+
+        /// Terminal flag
+        bool isTerminal;
+    };
+
+    /**
+     * @brief Base event object.
+     * 
+     * An event occurs where the event function changes sign. Event functions are evaluated with the physical time and the dimensional Cartesian state.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class BaseEvent {
+
+        protected:
+
+            /// Terminal flag (propagation stops at the first occurrence)
+            const bool m_isTerminal;
+
+            /// Crossing direction (increasing if positive, decreasing if negative, and both if zero)
+            const int m_direction;
+
+        public:
+
+            /**
+             * @brief Construct a new Base Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] isTerminal Terminal flag.
+             * @param[in] direction Crossing direction.
+             */
+            BaseEvent(const bool isTerminal = false, const int direction = 0);
+
+            /**
+             * @brief Destroy the Base Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            virtual ~BaseEvent();
+
+            /**
+             * @brief Evaluate the event function.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Cartesian state.
+             * @return T Event function value.
+             */
+            virtual T value(const T& t, const std::vector<T>& RV) const;
+
+            /**
+             * @brief Get the terminal flag.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return true Propagation stops at the first occurrence.
+             * @return false Propagation continues through occurrences.
+             */
+            bool is_terminal() const;
+
+            /**
+             * @brief Get the crossing direction.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return int Crossing direction.
+             */
+            int get_direction() const;
+
+    };
+
+    /**
+     * @brief Event for crossings of a geocentric altitude.
+     * 
+     * The event function is the altitude above the reference altitude, and is decreasing on descent.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class AltitudeEvent : public BaseEvent<T> {
+
+        protected:
+
+            /// Central body radius
+            const T m_radius;
+
+            /// Reference altitude
+            const T m_altitude;
+
+        public:
+
+            /**
+             * @brief Construct a new Altitude Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] radius Central body radius.
+             * @param[in] altitude Reference altitude.
+             * @param[in] isTerminal Terminal flag.
+             * @param[in] direction Crossing direction.
+             */
+            AltitudeEvent(const T& radius, const T& altitude, const bool isTerminal = false, const int direction = 0);
+
+            /**
+             * @brief Destroy the Altitude Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~AltitudeEvent();
+
+            /**
+             * @brief Evaluate the altitude above the reference altitude.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Cartesian state.
+             * @return T Altitude above the reference altitude.
+             */
+            T value(const T& t, const std::vector<T>& RV) const override;
+
+    };
+
+    /**
+     * @brief Event for crossings of the equatorial plane.
+     * 
+     * The event function is the out-of-plane position, and is increasing at the ascending node.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class NodeEvent : public BaseEvent<T> {
+
+        public:
+
+            /**
+             * @brief Construct a new Node Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] isTerminal Terminal flag.
+             * @param[in] direction Crossing direction.
+             */
+            NodeEvent(const bool isTerminal = false, const int direction = 0);
+
+            /**
+             * @brief Destroy the Node Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~NodeEvent();
+
+            /**
+             * @brief Evaluate the out-of-plane position.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Cartesian state.
+             * @return T Out-of-plane position.
+             */
+            T value(const T& t, const std::vector<T>& RV) const override;
+
+    };
+
+    /**
+     * @brief Event for eclipse entry and exit with a cylindrical shadow.
+     * 
+     * The Sun direction is fixed over the propagation. The event function is the distance from the edge of the shadow cylinder behind the central body (and the altitude elsewhere), and is negative in eclipse. Eclipse entry is therefore a decreasing crossing, and eclipse exit an increasing crossing.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class EclipseEvent : public BaseEvent<T> {
+
+        protected:
+
+            /// Central body radius
+            const T m_radius;
+
+            /// Unit vector towards the Sun
+            std::vector<T> m_sunDirection;
+
+        public:
+
+            /**
+             * @brief Construct a new Eclipse Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] radius Central body radius.
+             * @param[in] sunDirection Vector towards the Sun (normalised on construction).
+             * @param[in] isTerminal Terminal flag.
+             * @param[in] direction Crossing direction.
+             */
+            EclipseEvent(const T& radius, const std::vector<T>& sunDirection, const bool isTerminal = false, const int direction = 0);
+
+            /**
+             * @brief Destroy the Eclipse Event object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~EclipseEvent();
+
+            /**
+             * @brief Evaluate the distance from the shadow.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] t Current physical time.
+             * @param[in] RV Cartesian state.
+             * @return T Distance from the shadow.
+             */
+            T value(const T& t, const std::vector<T>& RV) const override;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
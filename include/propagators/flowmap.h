@@ -0,0 +1,140 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_PROPAGATORS_FLOWMAP
+#define THAMES_PROPAGATORS_FLOWMAP
+
+#include <cstddef>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../util/polynomials.h"
+
+namespace thames::util::polynomials {
+
+    // Macro to generate boilerplate to/from JSON
+    NLOHMANN_JSON_SERIALIZE_ENUM(PolynomialBases, {
+        {MONOMIAL, "Monomial"},
+        {CHEBYSHEV, "Chebyshev"}
+    })
+
+}
+
+namespace thames::propagators::flowmap {
+
+    /**
+     * @brief Structure to store the propagated polynomials of a single domain of a flow map.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    struct FlowMapDomain {
+        /// Minimum of each initial state variable
+        std::vector<T> lower;
+
+        /// Maximum of each initial state variable
+        std::vector<T> upper;
+
+        /// Coefficients of each state polynomial at each propagated epoch (epochs x state variables x monomials)
+        std::vector<std::vector<std::vector<T>>> coefficients;
+
+        // Macro to generate boilerplate to/from JSON
+        NLOHMANN_DEFINE_TYPE_INTRUSIVE(FlowMapDomain, lower, upper, coefficients)
+    };
+
+    /**
+     * @brief Structure to store a propagated polynomial flow map.
+     * 
+     * The flow map maps initial Cartesian states, within the bounds of its domains, to their Cartesian states at each epoch after the first. Each domain holds the polynomials propagated for one set of states (or one sub-domain after splitting), in the order of the graded monomial table.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    struct FlowMap {
+        /// Polynomial basis
+        thames::util::polynomials::PolynomialBases basis = thames::util::polynomials::MONOMIAL;
+
+        /// Number of variables
+        unsigned int nvar = 0;
+
+        /// Polynomial degree
+        unsigned int degree = 0;
+
+        /// Relative coefficient threshold for sparsification before sampling
+        T threshold = 0.0;
+
+        /// Vector of physical propagation times
+        std::vector<T> tvec;
+
+        /// Domains
+        std::vector<FlowMapDomain<T>> domains;
+
+        // Macro to generate boilerplate to/from JSON
+        NLOHMANN_DEFINE_TYPE_INTRUSIVE(FlowMap, basis, nvar, degree, threshold, tvec, domains)
+    };
+
+    /**
+     * @brief Select the domain of a flow map for a state.
+     * 
+     * The domain containing the state is selected. If no domain contains the state, the domain with the smallest excess, measured in the scaled variables of each domain (where the domain spans [-1,1]), is selected.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] map Flow map.
+     * @param[in] state Initial state.
+     * @param[out] excess Excess of the state beyond the selected domain, in scaled variables.
+     * @return std::size_t Index of the selected domain.
+     */
+    template<class T>
+    std::size_t select_domain(const FlowMap<T>& map, const std::vector<T>& state, T& excess);
+
+    /**
+     * @brief Evaluate a flow map for a set of states, without propagation.
+     * 
+     * @note States outside every domain are extrapolated with the nearest domain if their excess does not exceed the margin, otherwise an error is thrown.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] map Flow map.
+     * @param[in] states Initial states.
+     * @param[in] margin Largest permitted excess beyond the domains, in scaled variables.
+     * @return std::vector<std::vector<std::vector<T>>> States at each epoch, including the initial states.
+     */
+    template<class T>
+    std::vector<std::vector<std::vector<T>>> evaluate(const FlowMap<T>& map, const std::vector<std::vector<T>>& states, const T margin = 0.0);
+
+}
+
+#endif
\ No newline at end of file
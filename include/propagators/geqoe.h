@@ -60,15 +60,9 @@ namespace thames::propagators {
             /// Perturbation object
             using BasePropagator<T>::m_perturbation;
 
-            /// Dimensional factors
-            using BasePropagator<T>::m_factors;
-
             /// Gravitational parameter
             using BasePropagator<T>::m_mu;
 
-            /// Flag for whether to propagate in non-dimensional form
-            using BasePropagator<T>::m_isNonDimensional;
-
             /// State type for propagation
             using BasePropagator<T>::m_propstatetype;
 
@@ -82,9 +76,8 @@ namespace thames::propagators {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              */
-            GEqOEPropagator(const T& mu, const std::shared_ptr<BasePerturbation<T>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors);
+            GEqOEPropagator(const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation);
 
             /**
              * @brief State derivative for propagation using Generalised Equinoctial Orbital Elements (GEqOE).
@@ -95,8 +88,25 @@ namespace thames::propagators {
              * @param[in] geqoe GEqOE state.
              * @param[out] geqoedot Time derivative of the GEqOE state.
              * @param[in] t Current physical time.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             */
+            void derivative(const std::vector<T>& geqoe, std::vector<T>& geqoedot, const T t, const T mu, const BasePerturbation<T>& perturbation) const override;
+
+            /**
+             * @brief State derivative for propagation using Generalised Equinoctial Orbital Elements (GEqOE) for an ensemble of states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] geqoe Ensemble GEqOE states, stored component-wise (i.e. first element of all members, then second element, etc.).
+             * @param[out] geqoedot Ensemble time derivatives of the GEqOE states, stored component-wise.
+             * @param[in] t Current physical time.
+             * @param[in] n Number of ensemble members.
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
              */
-            void derivative(const std::vector<T>& geqoe, std::vector<T>& geqoedot, const T t) const override;
+            void derivative_ensemble(const std::vector<T>& geqoe, std::vector<T>& geqoedot, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const override;
 
     };
 
@@ -122,11 +132,6 @@ namespace thames::propagators {
     template<class T, template<class> class P>
     class GEqOEPropagatorPolynomialDynamics : public BasePropagatorPolynomialDynamics<T, P> {
 
-        public:
-
-            /// Flag for whether to propagate in non-dimensional form
-            using BasePropagatorPolynomialDynamics<T, P>::m_isNonDimensional;
-
         private:
 
             /// Gravitational parameter
@@ -135,9 +140,6 @@ namespace thames::propagators {
             /// Perturbation object
             using BasePropagatorPolynomialDynamics<T, P>::m_perturbation;
 
-            /// Dimensional factors
-            using BasePropagatorPolynomialDynamics<T, P>::m_factors;
-
         public:
 
             /**
@@ -148,9 +150,8 @@ namespace thames::propagators {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              */
-            GEqOEPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<const DimensionalFactors<T>> factors);
+            GEqOEPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation);
 
             /**
              * @brief Destroy the GEqOE Propagator Polynomial Dynamics object.
@@ -193,14 +194,22 @@ namespace thames::propagators {
             /// Perturbation object
             using BasePropagatorPolynomial<T, P>::m_perturbation;
 
-            /// Dimensional factors
-            using BasePropagatorPolynomial<T, P>::m_factors;
-
             /// Gravitational parameter
             using BasePropagatorPolynomial<T, P>::m_mu;
 
-            /// Dynamics object
-            using BasePropagatorPolynomial<T, P>::m_dyn;
+        protected:
+
+            /**
+             * @brief Create the GEqOE dynamics object for a propagation.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] mu Gravitational parameter, in the units of the propagation.
+             * @param[in] perturbation Perturbation object, in the units of the propagation.
+             * @return std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> Dynamics object.
+             */
+            std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> create_dynamics(const T mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) const override;
 
         public:
 
@@ -212,9 +221,8 @@ namespace thames::propagators {
              * 
              * @param[in] mu Gravitational parameter.
              * @param[in] perturbation Perturbation object.
-             * @param[in] factors Dimensional factors.
              */
-            GEqOEPropagatorPolynomial(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors);
+            GEqOEPropagatorPolynomial(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation);
 
             /**
              * @brief Destroy the GEqOE Propagator Polynomial object
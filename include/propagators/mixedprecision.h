@@ -0,0 +1,196 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef THAMES_PROPAGATORS_MIXEDPRECISION
+#define THAMES_PROPAGATORS_MIXEDPRECISION
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <boost/numeric/odeint.hpp>
+
+namespace thames::propagators::mixedprecision {
+
+    /**
+     * @brief Ensemble state split into a nominal state and the deviations of the members from it.
+     * 
+     * The nominal is held in full precision, whilst the deviations, which are small for tight ensembles, are held in a lower lane precision. Each member state is recovered as the sum of the nominal and its deviation.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type of the nominal.
+     * @tparam L Numeric type of the deviations.
+     */
+    template<class T, class L>
+    struct MixedPrecisionState {
+        /// Nominal state
+        std::vector<T> nominal;
+
+        /// Deviations of the members from the nominal, stored component-wise (i.e. first component of all members, then second component, etc.)
+        std::vector<L> deviations;
+    };
+
+    /**
+     * @brief Algebra applying the odeint operations element-wise to the nominal and deviations of a mixed-precision state.
+     * 
+     * For variable-step integration, the step control considers both the nominal and the deviations, with the tolerance of the deviations bounded below by the rounding floor of the lane precision.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    struct MixedPrecisionAlgebra {
+
+        /**
+         * @brief Apply an operation element-wise to a set of mixed-precision states.
+         * 
+         * @author Max Hallgarten La Casta
+         * @date 2026-10-19
+         * 
+         * @tparam Op Operation type.
+         * @tparam S Mixed-precision state types.
+         * @param[in] op Operation.
+         * @param[in,out] s Mixed-precision states.
+         */
+        template<class Op, class... S>
+        static void for_each(Op op, S&... s) {
+            // Apply operation to the nominal
+            const std::size_t nnominal = std::get<0>(std::tie(s...)).nominal.size();
+            for (std::size_t ii = 0; ii < nnominal; ii++)
+                op(s.nominal[ii]...);
+
+            // Apply operation to the deviations
+            const std::size_t ndeviations = std::get<0>(std::tie(s...)).deviations.size();
+            for (std::size_t ii = 0; ii < ndeviations; ii++)
+                op(s.deviations[ii]...);
+        }
+
+        // Element-wise operations, with the arities used by the steppers
+        template<class S1, class S2, class S3, class Op>
+        static void for_each3(S1& s1, S2& s2, S3& s3, Op op) {for_each(op, s1, s2, s3);}
+
+        template<class S1, class S2, class S3, class S4, class Op>
+        static void for_each4(S1& s1, S2& s2, S3& s3, S4& s4, Op op) {for_each(op, s1, s2, s3, s4);}
+
+        template<class S1, class S2, class S3, class S4, class S5, class Op>
+        static void for_each5(S1& s1, S2& s2, S3& s3, S4& s4, S5& s5, Op op) {for_each(op, s1, s2, s3, s4, s5);}
+
+        template<class S1, class S2, class S3, class S4, class S5, class S6, class Op>
+        static void for_each6(S1& s1, S2& s2, S3& s3, S4& s4, S5& s5, S6& s6, Op op) {for_each(op, s1, s2, s3, s4, s5, s6);}
+
+        template<class S1, class S2, class S3, class S4, class S5, class S6, class S7, class Op>
+        static void for_each7(S1& s1, S2& s2, S3& s3, S4& s4, S5& s5, S6& s6, S7& s7, Op op) {for_each(op, s1, s2, s3, s4, s5, s6, s7);}
+
+        template<class S1, class S2, class S3, class S4, class S5, class S6, class S7, class S8, class Op>
+        static void for_each8(S1& s1, S2& s2, S3& s3, S4& s4, S5& s5, S6& s6, S7& s7, S8& s8, Op op) {for_each(op, s1, s2, s3, s4, s5, s6, s7, s8);}
+
+        /**
+         * @brief Convert the error estimate of a mixed-precision state into ratios of the error to the tolerance.
+         * 
+         * The nominal uses the tolerance of the error checker. For the deviations, the tolerance is bounded below by the rounding floor of the lane precision, so that rounding in the error estimate does not force the timestep down.
+         * 
+         * @author Max Hallgarten La Casta
+         * @date 2026-10-19
+         * 
+         * @tparam T Numeric type of the nominal.
+         * @tparam L Numeric type of the deviations.
+         * @tparam Fac Numeric type of the tolerances.
+         * @param[in,out] err Error estimate, replaced by the ratios of the error to the tolerance.
+         * @param[in] x State at the start of the step.
+         * @param[in] dxdt State derivative at the start of the step.
+         * @param[in] op Relative error operation of the error checker.
+         */
+        template<class T, class L, class Fac>
+        static void for_each3(MixedPrecisionState<T, L>& err, const MixedPrecisionState<T, L>& x, const MixedPrecisionState<T, L>& dxdt, boost::numeric::odeint::default_operations::rel_error<Fac> op) {
+            // Apply operation to the nominal
+            for (std::size_t ii = 0; ii < err.nominal.size(); ii++)
+                op(err.nominal[ii], x.nominal[ii], dxdt.nominal[ii]);
+
+            // Apply operation to the deviations, with the tolerance bounded by the lane rounding floor
+            // NOTE: the timestep is included in the derivative factor of the operation
+            for (std::size_t ii = 0; ii < err.deviations.size(); ii++) {
+                const Fac scale = op.m_a_x*std::fabs((Fac) x.deviations[ii]) + op.m_a_dxdt*std::fabs((Fac) dxdt.deviations[ii]);
+                const Fac tolerance = std::max<Fac>(op.m_eps_abs + op.m_eps_rel*scale, rounding_factor*std::numeric_limits<L>::epsilon()*scale);
+                err.deviations[ii] = (L) (std::fabs((Fac) err.deviations[ii])/tolerance);
+            }
+        }
+
+        /**
+         * @brief Infinity norm of a mixed-precision state.
+         * 
+         * @author Max Hallgarten La Casta
+         * @date 2026-10-19
+         * 
+         * @tparam T Numeric type of the nominal.
+         * @tparam L Numeric type of the deviations.
+         * @param[in] s Mixed-precision state.
+         * @return T Infinity norm of the nominal and deviations.
+         */
+        template<class T, class L>
+        static T norm_inf(const MixedPrecisionState<T, L>& s) {
+            T norm = 0.0;
+            for (const T& x : s.nominal)
+                norm = std::max<T>(norm, std::fabs(x));
+            for (const L& x : s.deviations)
+                norm = std::max<T>(norm, std::fabs((T) x));
+            return norm;
+        }
+
+        /// Multiple of the lane machine epsilon bounding the rounding of the error estimate of the deviations, which sums the scaled stage derivatives of the stepper
+        static constexpr double rounding_factor = 16.0;
+
+    };
+
+}
+
+namespace boost::numeric::odeint {
+
+    // Resize temporary mixed-precision states of the steppers to match the integrated state
+    template<class T, class L>
+    struct is_resizeable<thames::propagators::mixedprecision::MixedPrecisionState<T, L>> : boost::true_type {};
+
+    template<class T, class L>
+    struct same_size_impl<thames::propagators::mixedprecision::MixedPrecisionState<T, L>, thames::propagators::mixedprecision::MixedPrecisionState<T, L>> {
+        static bool same_size(const thames::propagators::mixedprecision::MixedPrecisionState<T, L>& x1, const thames::propagators::mixedprecision::MixedPrecisionState<T, L>& x2) {
+            return x1.nominal.size() == x2.nominal.size() && x1.deviations.size() == x2.deviations.size();
+        }
+    };
+
+    template<class T, class L>
+    struct resize_impl<thames::propagators::mixedprecision::MixedPrecisionState<T, L>, thames::propagators::mixedprecision::MixedPrecisionState<T, L>> {
+        static void resize(thames::propagators::mixedprecision::MixedPrecisionState<T, L>& x1, const thames::propagators::mixedprecision::MixedPrecisionState<T, L>& x2) {
+            x1.nominal.resize(x2.nominal.size());
+            x1.deviations.resize(x2.deviations.size());
+        }
+    };
+
+}
+
+#endif
\ No newline at end of file
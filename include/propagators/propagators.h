@@ -27,6 +27,9 @@ SOFTWARE.
 
 #include "basepropagator.h"
 #include "cowell.h"
+#include "events.h"
+#include "flowmap.h"
 #include "geqoe.h"
+#include "mixedprecision.h"
 
 #endif
\ No newline at end of file
@@ -25,11 +25,32 @@ SOFTWARE.
 #ifndef THAMES_SETTINGS_PARAMETERS
 #define THAMES_SETTINGS_PARAMETERS
 
+#include <map>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
+// Macro to expand a parenthesised list of members
+#define THAMES_JSON_UNPACK(...) __VA_ARGS__
+
+// Macro to load a member from JSON, keeping its default value if absent
+#define THAMES_JSON_FROM_OPTIONAL(v1) nlohmann_json_t.v1 = nlohmann_json_j.value(#v1, nlohmann_json_default_obj.v1);
+
+// Macro to declare a conversion function for any JSON type, so that numbers can be parsed in the numeric type of the parameters
+#define THAMES_JSON_TEMPLATE template<class BasicJsonType, typename std::enable_if<nlohmann::detail::is_basic_json<BasicJsonType>::value, int>::type = 0>
+
+// Macro to generate boilerplate to/from JSON
+#define THAMES_DEFINE_TYPE_INTRUSIVE(Type, ...) \
+    THAMES_JSON_TEMPLATE friend void to_json(BasicJsonType& nlohmann_json_j, const Type& nlohmann_json_t) { NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(NLOHMANN_JSON_TO, __VA_ARGS__)) } \
+    THAMES_JSON_TEMPLATE friend void from_json(const BasicJsonType& nlohmann_json_j, Type& nlohmann_json_t) { NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(NLOHMANN_JSON_FROM, __VA_ARGS__)) }
+
+// Macro to generate boilerplate to/from JSON, with required members and optional members (default values if absent from the JSON)
+#define THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(Type, required, optional) \
+    THAMES_JSON_TEMPLATE friend void to_json(BasicJsonType& nlohmann_json_j, const Type& nlohmann_json_t) { NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(NLOHMANN_JSON_TO, THAMES_JSON_UNPACK required, THAMES_JSON_UNPACK optional)) } \
+    THAMES_JSON_TEMPLATE friend void from_json(const BasicJsonType& nlohmann_json_j, Type& nlohmann_json_t) { const Type nlohmann_json_default_obj{}; NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(NLOHMANN_JSON_FROM, THAMES_JSON_UNPACK required)) NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(THAMES_JSON_FROM_OPTIONAL, THAMES_JSON_UNPACK optional)) }
+
 namespace thames::settings {
 
     /**
@@ -56,7 +77,7 @@ namespace thames::settings {
         bool isInputFile;
 
         // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(Metadata, name, description, datetimeCreated, datetimeModified, isInputFile)
+        THAMES_DEFINE_TYPE_INTRUSIVE(Metadata, name, description, datetimeCreated, datetimeModified, isInputFile)
     };
 
     /**
@@ -79,7 +100,7 @@ namespace thames::settings {
         T Cd;
 
         // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(SpacecraftParameters, mass, dragArea, Cd)
+        THAMES_DEFINE_TYPE_INTRUSIVE(SpacecraftParameters, mass, dragArea, Cd)
     };
 
     /**
@@ -103,7 +124,7 @@ namespace thames::settings {
         unsigned int maxDegree;
 
         // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(GeopotentialPerturbationParameters, isEnabled, model, maxOrder, maxDegree)
+        THAMES_DEFINE_TYPE_INTRUSIVE(GeopotentialPerturbationParameters, isEnabled, model, maxOrder, maxDegree)
     };
 
     /**
@@ -121,7 +142,7 @@ namespace thames::settings {
         std::string model;
 
         // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(AtmospherePerturbationParameters, isEnabled, model)
+        THAMES_DEFINE_TYPE_INTRUSIVE(AtmospherePerturbationParameters, isEnabled, model)
     };
 
     /**
@@ -139,7 +160,36 @@ namespace thames::settings {
         AtmospherePerturbationParameters atmosphere;
 
         // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(PerturbationParameters, geopotential, atmosphere)
+        THAMES_DEFINE_TYPE_INTRUSIVE(PerturbationParameters, geopotential, atmosphere)
+    };
+
+    /**
+     * @brief Structure to store event parameters
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     */
+    template<class T>
+    struct EventParameters {
+        /// Event type ("Altitude", "Eclipse" or "Node")
+        std::string type;
+
+        /// Terminal flag (propagation stops at the first occurrence)
+        bool isTerminal;
+
+        /// Crossing direction (increasing if positive, decreasing if negative, and both if zero)
+        int direction;
+
+        /// Reference altitude for altitude events [km]
+        T altitude;
+
+        /// Vector towards the Sun for eclipse events [-]
+        std::vector<T> sunDirection;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(EventParameters, (type), (isTerminal, direction, altitude, sunDirection))
     };
 
     /**
@@ -182,8 +232,44 @@ namespace thames::settings {
         /// Variable-step relative tolerance
         T relativeTolerance;
 
-        // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(PropagatorParameters, startTime, endTime, equations, isNonDimensional, isFixedStep, intermediateOutput, timeStepIntermediate, timeStep, absoluteTolerance, relativeTolerance)
+        /// Number of samples integrated together with a common step (disabled if less than two)
+        unsigned int ensembleSize;
+
+        /// Integrate ensembles as a nominal in full precision and deviations of the samples in single precision
+        bool isMixedPrecision;
+
+        /// Number of threads evaluating polynomial output epochs alongside integration (disabled if zero)
+        unsigned int evaluationThreads;
+
+        /// Events detected during point propagation
+        std::vector<EventParameters<T>> events;
+
+        /// Number of states propagated together from a state file (all states if zero)
+        unsigned int chunkSize;
+
+        /// State transition matrix method ("Variational" for point propagation, "Taylor" for polynomial propagation, disabled if empty)
+        std::string stateTransitionMatrix;
+
+        /// Covariance propagation method ("STM" for linearised propagation, "Unscented" for the unscented transform, disabled if empty)
+        std::string covarianceMethod;
+
+        /// Spread of the unscented transform sigma points about the mean
+        T unscentedAlpha = 1.0;
+
+        /// Prior knowledge of the distribution for the unscented transform (two for Gaussian distributions)
+        T unscentedBeta = 2.0;
+
+        /// Secondary scaling parameter of the unscented transform
+        T unscentedKappa;
+
+        /// Number of threads propagating unscented transform sigma points (propagated together in turn if less than two)
+        unsigned int unscentedThreads;
+
+        /// Numeric precision of point propagation ("Float" for single precision, "Double", or "LongDouble" for the extended precision of the compiler's long double, double if empty)
+        std::string precision;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(PropagatorParameters, (startTime, endTime, equations, isNonDimensional, isFixedStep, intermediateOutput, timeStepIntermediate, timeStep, absoluteTolerance, relativeTolerance), (ensembleSize, isMixedPrecision, evaluationThreads, events, chunkSize, stateTransitionMatrix, covarianceMethod, unscentedAlpha, unscentedBeta, unscentedKappa, unscentedThreads, precision))
     };
 
     /**
@@ -203,8 +289,58 @@ namespace thames::settings {
         /// Maximum polynomial degree
         unsigned int maxDegree;
 
-        // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(PolynomialParameters, isEnabled, type, maxDegree)
+        /// Relative coefficient threshold for sparsification when sampling the propagated polynomials (propagation itself is unaffected)
+        double coefficientThreshold;
+
+        /// Nonlinearity indicator threshold for domain splitting (disabled if zero)
+        double splitThreshold;
+
+        /// Maximum number of successive domain splits
+        unsigned int maxSplitDepth;
+
+        /// Output file for the propagated flow map (disabled if empty)
+        std::string flowMapOutput;
+
+        /// Input file for a previously propagated flow map, evaluated in place of propagation (disabled if empty)
+        std::string flowMapInput;
+
+        /// Largest permitted excess of states beyond the flow map domains, in scaled variables
+        double flowMapMargin;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(PolynomialParameters, (isEnabled, type, maxDegree), (coefficientThreshold, splitThreshold, maxSplitDepth, flowMapOutput, flowMapInput, flowMapMargin))
+    };
+
+    /**
+     * @brief Structure to store sampling parameters
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     */
+    template<class T>
+    struct SamplingParameters {
+        /// Sampling method ("LHS", "Sobol", "Halton", or "Grid" for evenly spaced permutations streamed to state files, disabled if empty)
+        std::string method;
+
+        /// Number of samples (or number of points in each state variable for grid sampling)
+        unsigned int count;
+
+        /// Lower bounds of the samples relative to the mean state
+        std::vector<T> lowerBound;
+
+        /// Upper bounds of the samples relative to the mean state
+        std::vector<T> upperBound;
+
+        /// Random seed for Latin hypercube sampling
+        unsigned int seed;
+
+        /// Number of threads generating samples (serial if less than two)
+        unsigned int threads;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(SamplingParameters, (method), (count, lowerBound, upperBound, seed, threads))
     };
 
     /**
@@ -226,8 +362,96 @@ namespace thames::settings {
         /// State type
         std::string statetype;
 
+        /// Binary state file (NumPy or raw 64-bit floats) used in place of the state vectors (disabled if empty)
+        std::string file;
+
+        /// State transition matrices (6x6, row-major) from the start time, for each state (empty if not computed)
+        std::vector<std::vector<T>> stms;
+
+        /// Covariance (6x6, row-major) of the state (empty if not propagated)
+        std::vector<T> covariance;
+
+        /// Samples generated about the single state vector, used in place of the state vectors
+        SamplingParameters<T> sampling;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(StateParameters, (datetime, states, statetype), (file, stms, covariance, sampling))
+    };
+
+    /**
+     * @brief Structure to store event occurrences
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     */
+    template<class T>
+    struct EventRecord {
+        /// Index of the event in the propagator parameters
+        unsigned int event;
+
+        /// Event type
+        std::string type;
+
+        /// Index of the state in the input states
+        unsigned int sample;
+
+        /// Event time
+        T datetime;
+
+        /// State at the event
+        std::vector<T> state;
+
+        /// Terminal flag
+        bool isTerminal;
+
+        // Macro to generate boilerplate to/from JSON
+        THAMES_DEFINE_TYPE_INTRUSIVE(EventRecord, event, type, sample, datetime, state, isTerminal)
+    };
+
+    /**
+     * @brief Structure to store profiling parameters
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    struct ProfilingParameters {
+        /// Flag for whether the execution is profiled
+        bool isEnabled;
+
+        /// Period (in calls per thread) at which the individual perturbation models are timed (disabled if zero)
+        unsigned int perturbationSampling;
+
+        /// Output file for the Chrome trace of the timed intervals (disabled if empty)
+        std::string traceOutput;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(ProfilingParameters, (isEnabled), (perturbationSampling, traceOutput))
+    };
+
+    /**
+     * @brief Structure to store the accumulated time of a profiled section
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type
+     */
+    template<class T>
+    struct ProfileEntry {
+        /// Section name
+        std::string name;
+
+        /// Number of timed intervals
+        unsigned long long count;
+
+        /// Total time of the intervals (in seconds)
+        T totalTime;
+
         // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(StateParameters, datetime, states, statetype)
+        THAMES_DEFINE_TYPE_INTRUSIVE(ProfileEntry, name, count, totalTime)
     };
 
     /**
@@ -242,8 +466,11 @@ namespace thames::settings {
     struct ExecutionStatistics {
         T propagationTime;
 
-        // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(ExecutionStatistics, propagationTime)
+        /// Accumulated times of the profiled sections (empty if not profiled)
+        std::vector<ProfileEntry<T>> timers;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(ExecutionStatistics, (propagationTime), (timers))
     };
 
     /**
@@ -271,14 +498,43 @@ namespace thames::settings {
         /// Polynomial parameters
         PolynomialParameters polynomial;
 
+        /// Profiling parameters
+        ProfilingParameters profiling;
+
         /// State parameters
         std::vector<StateParameters<T>> states;
 
+        /// Event occurrences
+        std::vector<EventRecord<T>> events;
+
         /// Execution statistics
         ExecutionStatistics<T> statistics;
 
-        // Macro to generate boilerplate to/from JSON
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(Parameters, metadata, spacecraft, perturbation, propagator, polynomial, states, statistics)
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(Parameters, (metadata, spacecraft, perturbation, propagator, polynomial, states, statistics), (profiling, events))
+    };
+
+    /**
+     * @brief Structure to store sweep parameters
+     * 
+     * Each swept parameter is identified by its dotted path within the parameters (e.g. "propagator.timeStep"), and the sweep covers the Cartesian product of the values provided.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    struct SweepParameters {
+        /// Number of worker threads (hardware concurrency if zero)
+        unsigned int threads;
+
+        /// Values of each swept parameter
+        std::map<std::string, std::vector<nlohmann::json>> parameters;
+
+        /// Output file of a reference run, against which the error statistics of each case are calculated (disabled if empty)
+        std::string reference;
+
+        // Macro to generate boilerplate to/from JSON, with optional members
+        THAMES_DEFINE_TYPE_INTRUSIVE_OPTIONAL(SweepParameters, (parameters), (threads, reference))
     };
 
 }
@@ -0,0 +1,100 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_UTIL_COVARIANCE
+#define THAMES_UTIL_COVARIANCE
+
+#include <vector>
+
+namespace thames::util::covariance {
+
+    /**
+     * @brief Calculate the lower-triangular Cholesky factor of a symmetric positive-definite matrix.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] A Matrix (n x n, row-major).
+     * @param[in] n Matrix dimension.
+     * @return std::vector<T> Lower-triangular factor L, such that A = L L^T (n x n, row-major).
+     */
+    template<class T>
+    std::vector<T> cholesky(const std::vector<T>& A, const std::size_t n);
+
+    /**
+     * @brief Transform a covariance through a linear map.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] matrix Linear map M, such as a state transition matrix (n x n, row-major).
+     * @param[in] covariance Covariance P (n x n, row-major).
+     * @param[in] n Matrix dimension.
+     * @return std::vector<T> Transformed covariance M P M^T (n x n, row-major).
+     */
+    template<class T>
+    std::vector<T> transform(const std::vector<T>& matrix, const std::vector<T>& covariance, const std::size_t n);
+
+    /**
+     * @brief Generate the sigma points and weights of the scaled covariance transform.
+     * 
+     * The 2n+1 sigma points are the mean, and the mean plus and minus each column of the scaled Cholesky factor of the covariance.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] mean Mean (n).
+     * @param[in] covariance Covariance (n x n, row-major).
+     * @param[in] alpha Spread of the sigma points about the mean.
+     * @param[in] beta Prior knowledge of the distribution (two for Gaussian distributions).
+     * @param[in] kappa Secondary scaling parameter.
+     * @param[out] points Sigma points.
+     * @param[out] weightsMean Weights for the reconstruction of the mean.
+     * @param[out] weightsCovariance Weights for the reconstruction of the covariance.
+     */
+    template<class T>
+    void sigma_points(const std::vector<T>& mean, const std::vector<T>& covariance, const T alpha, const T beta, const T kappa, std::vector<std::vector<T>>& points, std::vector<T>& weightsMean, std::vector<T>& weightsCovariance);
+
+    /**
+     * @brief Reconstruct the mean and covariance from a set of weighted points.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] points Points.
+     * @param[in] weightsMean Weights for the reconstruction of the mean.
+     * @param[in] weightsCovariance Weights for the reconstruction of the covariance.
+     * @param[out] mean Mean (n).
+     * @param[out] covariance Covariance (n x n, row-major).
+     */
+    template<class T>
+    void reconstruct(const std::vector<std::vector<T>>& points, const std::vector<T>& weightsMean, const std::vector<T>& weightsCovariance, std::vector<T>& mean, std::vector<T>& covariance);
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_UTIL_PIPELINE
+#define THAMES_UTIL_PIPELINE
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace thames::util::pipeline {
+
+    /**
+     * @brief Bounded first-in first-out queue for passing work between pipeline stages on different threads.
+     * 
+     * Producers block whilst the queue is full, and consumers block whilst it is empty, so that the memory held between stages is bounded by the capacity. Closing the queue rejects further items, whilst items already queued may still be consumed.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam Item Item type.
+     */
+    template<class Item>
+    class BoundedQueue {
+
+        protected:
+
+            /// Maximum number of queued items
+            const std::size_t m_capacity;
+
+            /// Queued items
+            std::deque<Item> m_items;
+
+            /// Flag for whether the queue is closed
+            bool m_closed = false;
+
+            /// Mutex guarding the items and flag
+            std::mutex m_mutex;
+
+            /// Condition variable to signal that an item was removed or the queue closed
+            std::condition_variable m_notFull;
+
+            /// Condition variable to signal that an item was added or the queue closed
+            std::condition_variable m_notEmpty;
+
+        public:
+
+            /**
+             * @brief Construct a new Bounded Queue object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] capacity Maximum number of queued items.
+             */
+            BoundedQueue(const std::size_t capacity) : m_capacity(capacity > 0 ? capacity : 1) {
+
+            }
+
+            BoundedQueue(const BoundedQueue&) = delete;
+            BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+            /**
+             * @brief Add an item, waiting for space if the queue is full.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] item Item.
+             * @return true Item added.
+             * @return false Queue closed, and item discarded.
+             */
+            bool push(Item item) {
+                // Wait for space or closure
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_notFull.wait(lock, [this]{ return m_closed || m_items.size() < m_capacity; });
+                if (m_closed)
+                    return false;
+
+                // Add item and wake a consumer
+                m_items.push_back(std::move(item));
+                m_notEmpty.notify_one();
+                return true;
+            }
+
+            /**
+             * @brief Remove an item, waiting for one if the queue is empty.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[out] item Item.
+             * @return true Item removed.
+             * @return false Queue closed and empty.
+             */
+            bool pop(Item& item) {
+                // Wait for an item or closure
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_notEmpty.wait(lock, [this]{ return m_closed || !m_items.empty(); });
+                if (m_items.empty())
+                    return false;
+
+                // Remove item and wake a producer
+                item = std::move(m_items.front());
+                m_items.pop_front();
+                m_notFull.notify_one();
+                return true;
+            }
+
+            /**
+             * @brief Close the queue, waking all waiting producers and consumers.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            void close() {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_closed = true;
+                }
+                m_notFull.notify_all();
+                m_notEmpty.notify_all();
+            }
+
+    };
+
+}
+
+#endif
\ No newline at end of file
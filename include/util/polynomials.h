@@ -25,12 +25,243 @@ SOFTWARE.
 #ifndef THAMES_UTIL_POLYNOMIALS
 #define THAMES_UTIL_POLYNOMIALS
 
+#include <cstddef>
 #include <vector>
 
 namespace thames::util::polynomials {
 
+    /// Enumeration to store polynomial bases supported by the batched evaluation kernel
+    enum PolynomialBases {
+        MONOMIAL,
+        CHEBYSHEV
+    };
+
+    /**
+     * @brief Structure to contain the graded table of monomial exponents for a number of variables and maximum degree.
+     * 
+     * Monomials are ordered by total degree and, within each degree, by descending exponent of the first variable (then recursively for the remaining variables). This matches the coefficient ordering of the SMART-UQ polynomials.
+     * 
+     * Each monomial (other than the constant) also stores a parent monomial, obtained by removing the last variable with a non-zero exponent, so that monomial products can be constructed with a single multiplication each.
+     */
+    struct MonomialTable {
+        /// Number of variables
+        unsigned int nvar = 0;
+        /// Maximum degree
+        unsigned int degree = 0;
+        /// Number of monomials
+        std::size_t nterms = 0;
+        /// Exponents of each monomial (nterms x nvar, row-major)
+        std::vector<unsigned int> exponents;
+        /// Index of the parent monomial
+        std::vector<std::size_t> parent;
+        /// Variable removed to obtain the parent monomial
+        std::vector<unsigned int> variable;
+        /// Exponent of the variable removed to obtain the parent monomial
+        std::vector<unsigned int> power;
+    };
+
+    /**
+     * @brief Retrieve the graded monomial table for a number of variables and maximum degree.
+     * 
+     * Tables are generated on first use and cached for the lifetime of the process.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] nvar Number of variables.
+     * @param[in] degree Maximum degree.
+     * @return const MonomialTable& Monomial table.
+     */
+    const MonomialTable& monomial_table(const unsigned int nvar, const unsigned int degree);
+
+    /**
+     * @brief Structure to contain a set of polynomials in a sparse form for batched evaluation.
+     * 
+     * Only monomials with a retained coefficient in at least one polynomial are stored, together with the ancestor monomials required to construct their products. Coefficients are interleaved by monomial, so that all polynomials are accumulated from each monomial product in turn.
+     * 
+     * @note This form is only used to sample propagated polynomials. The polynomials are stored and multiplied during propagation in the dense form of SMART-UQ, so the coefficient threshold does not reduce the cost of propagation.
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    struct SparsePolynomials {
+        /// Number of variables
+        unsigned int nvar = 0;
+        /// Maximum degree
+        unsigned int degree = 0;
+        /// Polynomial basis
+        PolynomialBases basis = MONOMIAL;
+        /// Number of polynomials
+        std::size_t npoly = 0;
+        /// Monomial table indices of the stored monomials, in graded order
+        std::vector<std::size_t> monomials;
+        /// Position of the parent of each stored monomial
+        std::vector<std::size_t> parent;
+        /// Variable removed to obtain the parent of each stored monomial
+        std::vector<unsigned int> variable;
+        /// Exponent of the variable removed to obtain the parent of each stored monomial
+        std::vector<unsigned int> power;
+        /// Positions of the stored monomials with retained coefficients
+        std::vector<std::size_t> active;
+        /// Retained coefficients (active x npoly, row-major)
+        std::vector<T> coefficients;
+    };
+
+    /**
+     * @brief Generate the sparse form of a set of polynomials, given by their coefficients, for batched evaluation.
+     * 
+     * Coefficients with a magnitude no greater than the threshold, relative to the largest coefficient magnitude of their polynomial, are discarded. A threshold of zero only discards zero coefficients.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] coefficients Coefficients of each polynomial, in the order of the monomial table.
+     * @param[in] table Monomial table.
+     * @param[in] basis Polynomial basis.
+     * @param[in] threshold Relative coefficient threshold.
+     * @return SparsePolynomials<T> Sparse polynomials.
+     */
+    template<class T>
+    SparsePolynomials<T> sparse_polynomials(const std::vector<std::vector<T>>& coefficients, const MonomialTable& table, const PolynomialBases basis, const T threshold = 0.0);
+
+    /**
+     * @brief Evaluate a set of sparse polynomials at a set of points.
+     * 
+     * Points are processed in blocks stored in a structure-of-arrays layout, with the univariate basis functions and monomial products shared between all polynomials. For large sets of points, blocks are distributed across the shared thread pool, unless the caller is already a pool worker.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] polynomials Sparse polynomials.
+     * @param[in] x Evaluation points.
+     * @return std::vector<std::vector<T>> Values of each polynomial at each point.
+     */
+    template<class T>
+    std::vector<std::vector<T>> evaluate_sparse(const SparsePolynomials<T>& polynomials, const std::vector<std::vector<T>>& x);
+
+    /**
+     * @brief Evaluate a set of polynomials, given by their coefficients, at a set of points.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] coefficients Coefficients of each polynomial, in the order of the monomial table.
+     * @param[in] table Monomial table.
+     * @param[in] basis Polynomial basis.
+     * @param[in] x Evaluation points.
+     * @return std::vector<std::vector<T>> Values of each polynomial at each point.
+     */
+    template<class T>
+    std::vector<std::vector<T>> evaluate_coefficients(const std::vector<std::vector<T>>& coefficients, const MonomialTable& table, const PolynomialBases basis, const std::vector<std::vector<T>>& x);
+
+    /**
+     * @brief Calculate the nonlinearity indicator of a set of polynomials, given by their coefficients.
+     * 
+     * The indicator is the largest ratio, across the polynomials, between the magnitude of the highest-degree coefficients and the magnitude of the linear coefficients. The contribution of each variable to the highest-degree coefficients is also returned, to select the variable along which to split the domain.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] coefficients Coefficients of each polynomial, in the order of the monomial table.
+     * @param[in] table Monomial table.
+     * @param[out] scores Relative contribution of each variable to the highest-degree coefficients.
+     * @return T Nonlinearity indicator.
+     */
+    template<class T>
+    T nonlinearity_indicator(const std::vector<std::vector<T>>& coefficients, const MonomialTable& table, std::vector<T>& scores);
+
     #ifdef THAMES_USE_SMARTUQ
 
+    /**
+     * @brief Lease on the multiplication table of a polynomial type.
+     * 
+     * SMART-UQ keeps a single resident multiplication table per polynomial type, which depends only on the number of variables and the maximum degree. Leases are reference counted per table, keyed by the number of variables, maximum degree and basis, and the resident table is only rebuilt when a lease is requested for a different size whilst no leases are held on the resident table. Leases of the resident table never block, so threads may share the lease of the propagating thread without locking. A nested lease of a different size in one thread displaces the resident table if the thread holds all of its leases, and restores it on release; otherwise the lease waits until the resident table is released. Threads sharing a table must therefore not nest leases of a different size concurrently, as each would wait for the others.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @tparam P Polynomial type.
+     */
+    template<class T, template<class> class P>
+    class MultiplicationTableLease {
+
+        protected:
+
+            /// Number of variables
+            unsigned int m_nvar;
+
+            /// Maximum degree
+            unsigned int m_degree;
+
+            /// Flag for whether the lease displaced the resident table
+            bool m_isDisplacing;
+
+            /// Number of variables of the displaced table
+            unsigned int m_displacedNvar = 0;
+
+            /// Maximum degree of the displaced table
+            unsigned int m_displacedDegree = 0;
+
+        public:
+
+            /**
+             * @brief Construct a new Multiplication Table Lease object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] nvar Number of variables.
+             * @param[in] degree Maximum degree.
+             */
+            MultiplicationTableLease(const unsigned int nvar, const unsigned int degree);
+
+            /**
+             * @brief Destroy the Multiplication Table Lease object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~MultiplicationTableLease();
+
+            MultiplicationTableLease(const MultiplicationTableLease&) = delete;
+            MultiplicationTableLease& operator=(const MultiplicationTableLease&) = delete;
+
+    };
+
+    /**
+     * @brief Ensure that the multiplication table of a polynomial type is initialised for a given size.
+     * 
+     * @note The table may be rebuilt for a different size once this function returns. Hold a MultiplicationTableLease for the duration of any polynomial arithmetic that relies on the table.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @tparam P Polynomial type.
+     * @param[in] nvar Number of variables.
+     * @param[in] degree Maximum degree.
+     */
+    template<class T, template<class> class P>
+    void initialise_multiplication_table(const unsigned int nvar, const unsigned int degree);
+
+    /**
+     * @brief Retrieve the basis of a polynomial type.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam P Polynomial type.
+     * @return PolynomialBases Polynomial basis.
+     */
+    template<template<class> class P>
+    PolynomialBases polynomial_basis();
+
     /**
      * @brief Evaluate vector of polynomials at a point.
      * 
@@ -49,6 +280,8 @@ namespace thames::util::polynomials {
     /**
      * @brief Evaluate vector of polynomials at a set of points.
      * 
+     * @note Evaluation uses the batched kernel, with the coefficients in the graded order of the monomial table, as stored by SMART-UQ for every basis, and the basis of the polynomial type. The layout is checked on each call against SMART-UQ's own evaluation at a single probe point, and an error is thrown on a mismatch.
+     * 
      * @author Max Hallgarten La Casta
      * @date 2022-02-18
      * 
@@ -56,10 +289,26 @@ namespace thames::util::polynomials {
      * @tparam P Polynomial type.
      * @param[in] polynomials Vector of polynomials.
      * @param[in] x Evaluation points. 
+     * @param[in] threshold Relative coefficient threshold for sparsification.
      * @return std::vector<std::vector<T>> Point state vectors.
      */   
     template<class T, template<class> class P>
-    std::vector<std::vector<T>> evaluate_polynomials(const std::vector<P<T>>& polynomials, const std::vector<std::vector<T>>& x);
+    std::vector<std::vector<T>> evaluate_polynomials(const std::vector<P<T>>& polynomials, const std::vector<std::vector<T>>& x, const T threshold = 0.0);
+
+    /**
+     * @brief Calculate the nonlinearity indicator of a vector of polynomials.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @tparam P Polynomial type.
+     * @param[in] polynomials Vector of polynomials.
+     * @param[out] scores Relative contribution of each variable to the highest-degree coefficients.
+     * @return T Nonlinearity indicator.
+     */
+    template<class T, template<class> class P>
+    T nonlinearity_indicator(const std::vector<P<T>>& polynomials, std::vector<T>& scores);
 
     #endif
 
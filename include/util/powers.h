@@ -0,0 +1,105 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_UTIL_POWERS
+#define THAMES_UTIL_POWERS
+
+namespace thames::util::powers{
+
+    ///////////
+    // Reals //
+    ///////////
+
+    /**
+     * @brief Raise a value to a compile-time integer power.
+     * 
+     * The power is expanded by repeated squaring at compile time, avoiding the
+     * overhead of the generic pow function. As only multiplication is used, the
+     * function is valid for both real and polynomial types.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam N Exponent.
+     * @tparam T Numeric type.
+     * @param[in] x Base.
+     * @return T Base raised to the power of the exponent.
+     */
+    template<unsigned int N, class T>
+    constexpr T ipow(const T& x){
+        // Check exponent is non-zero
+        static_assert(N >= 1, "Exponent must be positive");
+
+        // Expand power by repeated squaring
+        if constexpr (N == 1){
+            return x;
+        } else if constexpr (N % 2 == 0){
+            const T y = ipow<N/2>(x);
+            return y*y;
+        } else {
+            return x*ipow<N-1>(x);
+        }
+    }
+
+    /**
+     * @brief Cube root.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] x Argument.
+     * @return T Cube root of the argument.
+     */
+    template<class T>
+    T cbrt(const T& x);
+
+    /////////////////
+    // Polynomials //
+    /////////////////
+
+    #ifdef THAMES_USE_SMARTUQ
+
+    /**
+     * @brief Cube root.
+     * 
+     * Evaluated with a single fractional power, which is cheaper than the
+     * nested powers it replaces in the dynamics.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @tparam P Polynomial type.
+     * @param[in] x Argument.
+     * @return P<T> Cube root of the argument.
+     */
+    template<class T, template<class> class P>
+    P<T> cbrt(const P<T>& x);
+
+    #endif
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,188 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_UTIL_PROFILING
+#define THAMES_UTIL_PROFILING
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace thames::util::profiling {
+
+    /// Clock used for profiling
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Structure to store the accumulated time of a named timer.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    struct TimerStatistics {
+        /// Timer name
+        std::string name;
+
+        /// Number of timed intervals
+        std::size_t count = 0;
+
+        /// Total time of the intervals (s)
+        double totalTime = 0.0;
+    };
+
+    /**
+     * @brief Enable process-wide profiling, and clear any previous records.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] trace Flag for whether each interval is stored for a Chrome trace.
+     * @param[in] perturbationSampling Interval between sampled evaluations of the individual perturbation models on each thread (disabled if zero).
+     */
+    void enable(const bool trace = false, const unsigned int perturbationSampling = 0);
+
+    /**
+     * @brief Disable profiling, keeping the records.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    void disable();
+
+    /**
+     * @brief Get whether profiling is enabled.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @return bool Flag for whether profiling is enabled.
+     */
+    bool is_enabled();
+
+    /**
+     * @brief Decide whether the current evaluation of the perturbation models should be timed.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @return bool Flag for whether the evaluation is sampled.
+     */
+    bool sample_perturbation();
+
+    /**
+     * @brief Record a timed interval.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] name Timer name.
+     * @param[in] start Start of the interval.
+     * @param[in] end End of the interval.
+     */
+    void record(const std::string& name, const Clock::time_point start, const Clock::time_point end);
+
+    /**
+     * @brief Get the accumulated times of each timer.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @return std::vector<TimerStatistics> Timer statistics, ordered by name.
+     */
+    std::vector<TimerStatistics> report();
+
+    /**
+     * @brief Save the recorded intervals in the Chrome trace event format.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @param[in] filepath Path to the trace file.
+     */
+    void save_trace(const std::string& filepath);
+
+    /**
+     * @brief Timer recording the interval between its construction and destruction.
+     * 
+     * The timer does nothing unless profiling is enabled when it is constructed.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    class ScopedTimer {
+
+        protected:
+
+            /// Timer name
+            std::string m_name;
+
+            /// Flag for whether the interval is recorded
+            bool m_active;
+
+            /// Start of the interval
+            Clock::time_point m_start;
+
+        public:
+
+            /**
+             * @brief Construct a new Scoped Timer object, and start the interval.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] name Timer name.
+             * @param[in] active Flag for whether the interval should be recorded.
+             */
+            ScopedTimer(const char* name, const bool active = true);
+
+            /**
+             * @brief Destroy the Scoped Timer object, and record the interval.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~ScopedTimer();
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+            /**
+             * @brief Record the interval before the end of the scope.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            void stop();
+
+    };
+
+}
+
+#endif
\ No newline at end of file
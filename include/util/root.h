@@ -49,6 +49,24 @@ namespace thames::util::root{
     template<class T>
     T golden_section_search(std::function<T (T)> func, T a, T b, T tol = 1e-10);
 
+    /**
+     * @brief Brent's method for root finding within a bracket.
+     * 
+     * Combines bisection, secant and inverse quadratic interpolation steps, whilst keeping the root bracketed.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] func Scalar function for root finding, which must change sign between the boundaries.
+     * @param[in] a Left hand boundary.
+     * @param[in] b Right hand boundary.
+     * @param[in] tol Solver tolerance.
+     * @return T Argument of the root.
+     */
+    template<class T>
+    T brent(const std::function<T (T)>& func, T a, T b, T tol = 1e-10);
+
     /**
      * @brief Newton-Raphson method for root finding.
      * 
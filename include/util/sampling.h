@@ -25,8 +25,19 @@ SOFTWARE.
 #ifndef THAMES_UTIL_SAMPLING
 #define THAMES_UTIL_SAMPLING
 
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 namespace thames::util::sampling {
 
+    /// Enumeration to store sampling methods supported by the sample generator
+    enum SamplingMethods {
+        LATIN_HYPERCUBE,
+        SOBOL,
+        HALTON
+    };
+
     /**
      * @brief Calculate evenly spaced points over the [a,b] interval.
      * 
@@ -44,9 +55,100 @@ namespace thames::util::sampling {
     template<class T>
     std::vector<T> linspace(const T a, const T b, const unsigned int n);
 
+    /**
+     * @brief Lazy grid of the permutations of sets of points in each state variable.
+     * 
+     * The grid is never materialised: permutations are generated from their index on request, with the last variable varying fastest. Contiguous ranges of the index space can be read in chunks, or partitioned between threads.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class CartesianGrid {
+
+        protected:
+
+            /// Points in each state variable
+            std::vector<std::vector<T>> m_points;
+
+            /// Number of permutations
+            std::size_t m_size = 0;
+
+        public:
+
+            /**
+             * @brief Construct a new Cartesian Grid object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] points Vector of vectors of points in each state variable.
+             */
+            CartesianGrid(const std::vector<std::vector<T>>& points);
+
+            /**
+             * @brief Get the number of permutations.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::size_t Number of permutations.
+             */
+            std::size_t size() const;
+
+            /**
+             * @brief Get the state dimension.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::size_t State dimension.
+             */
+            std::size_t dimension() const;
+
+            /**
+             * @brief Generate a permutation from its index.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] index Index of the permutation.
+             * @return std::vector<T> Permutation.
+             */
+            std::vector<T> state(const std::size_t index) const;
+
+            /**
+             * @brief Generate a contiguous range of permutations.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] start Index of the first permutation.
+             * @param[in] count Number of permutations.
+             * @return std::vector<std::vector<T>> Permutations.
+             */
+            std::vector<std::vector<T>> read(const std::size_t start, const std::size_t count) const;
+
+            /**
+             * @brief Partition the index space into contiguous ranges of near-equal size.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] nparts Number of partitions.
+             * @return std::vector<std::pair<std::size_t, std::size_t>> Start and end (exclusive) indices of each partition.
+             */
+            std::vector<std::pair<std::size_t, std::size_t>> partition(const std::size_t nparts) const;
+
+    };
+
     /**
      * @brief Generate permuations of Cartesian states from sets of points in each state variable.
      * 
+     * @note The permutations are materialised from a CartesianGrid, which should be used directly for large grids.
+     * 
      * @author Max Hallgarten La Casta
      * @date 2022-02-01
      * 
@@ -57,6 +159,77 @@ namespace thames::util::sampling {
     template<class T>
     std::vector<std::vector<T>> cartesian_permutations(const std::vector<std::vector<T>>& points);
 
+    /**
+     * @brief Generate points of the Halton sequence in the unit hypercube.
+     * 
+     * The sequence uses the first dim primes as bases, and starts from its second point to omit the origin.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] n Number of points.
+     * @param[in] dim Number of dimensions.
+     * @param[in] offset Index of the first point in the sequence, so that blocks of the sequence can be generated independently.
+     * @return std::vector<T> Points (n x dim, row-major).
+     */
+    template<class T>
+    std::vector<T> halton(const std::size_t n, const std::size_t dim, const std::size_t offset = 0);
+
+    /**
+     * @brief Generate points of the Sobol sequence in the unit hypercube.
+     * 
+     * The sequence uses the Joe-Kuo direction numbers for up to eight dimensions, and starts from its second point to omit the origin. Each point is calculated directly from its index, rather than from the previous point in Gray code order.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] n Number of points.
+     * @param[in] dim Number of dimensions.
+     * @param[in] offset Index of the first point in the sequence, so that blocks of the sequence can be generated independently.
+     * @return std::vector<T> Points (n x dim, row-major).
+     */
+    template<class T>
+    std::vector<T> sobol(const std::size_t n, const std::size_t dim, const std::size_t offset = 0);
+
+    /**
+     * @brief Generate a random Latin hypercube sample in the unit hypercube.
+     * 
+     * Each dimension is divided into n equal strata, and each stratum is sampled once at a uniformly random position. Each dimension draws from its own generator, with the seed offset by the dimension index, so that each dimension matches a one-dimensional sample with the offset seed.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] n Number of points.
+     * @param[in] dim Number of dimensions.
+     * @param[in] seed Random seed.
+     * @return std::vector<T> Points (n x dim, row-major).
+     */
+    template<class T>
+    std::vector<T> latin_hypercube(const std::size_t n, const std::size_t dim, const unsigned int seed);
+
+    /**
+     * @brief Generate samples within a box.
+     * 
+     * @note If more than one thread is requested, blocks of the Sobol and Halton sequences, and the dimensions of Latin hypercube samples, are generated across a thread pool. The samples are independent of the number of threads.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] method Sampling method.
+     * @param[in] n Number of samples.
+     * @param[in] lower Lower bounds of the box.
+     * @param[in] upper Upper bounds of the box.
+     * @param[in] seed Random seed (Latin hypercube sampling only).
+     * @param[in] threads Number of threads (serial if less than two).
+     * @return std::vector<T> Samples (n x dim, row-major).
+     */
+    template<class T>
+    std::vector<T> generate_samples(const SamplingMethods method, const std::size_t n, const std::vector<T>& lower, const std::vector<T>& upper, const unsigned int seed = 0, const unsigned int threads = 0);
+
 }
 
 #endif
\ No newline at end of file
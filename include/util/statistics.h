@@ -0,0 +1,173 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_UTIL_STATISTICS
+#define THAMES_UTIL_STATISTICS
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace thames::util::statistics {
+
+    /**
+     * @brief Structure to store error statistics of a set of Cartesian states against reference states.
+     * 
+     * Radial, along-track and cross-track (RSW) errors are measured in the frame of each reference state.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    struct ErrorStatistics {
+        /// Number of samples
+        std::size_t nsamples = 0;
+
+        /// Root mean square position error
+        T drRms = 0.0;
+
+        /// Root mean square velocity error
+        T dvRms = 0.0;
+
+        /// Maximum position error
+        T drMax = 0.0;
+
+        /// Maximum velocity error
+        T dvMax = 0.0;
+
+        /// Root mean square position errors in the radial, along-track and cross-track directions
+        std::vector<T> rswRms = std::vector<T>(3, 0.0);
+
+        /// Mean position errors in the radial, along-track and cross-track directions
+        std::vector<T> rswMean = std::vector<T>(3, 0.0);
+
+        /// Index of the dominant direction of the mean position error (0 radial, 1 along-track, 2 cross-track)
+        std::size_t rswDominant = 0;
+    };
+
+    /**
+     * @brief Accumulator of error statistics, to which sets of states can be added in chunks.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     */
+    template<class T>
+    class ErrorAccumulator {
+
+        protected:
+
+            /// Number of samples
+            std::size_t m_nsamples = 0;
+
+            /// Sums of squared position and velocity errors
+            T m_dr2 = 0.0, m_dv2 = 0.0;
+
+            /// Maximum position and velocity errors
+            T m_drMax = 0.0, m_dvMax = 0.0;
+
+            /// Sums of RSW position errors and of their squares
+            std::vector<T> m_rsw = std::vector<T>(3, 0.0), m_rsw2 = std::vector<T>(3, 0.0);
+
+        public:
+
+            /**
+             * @brief Add a set of states and their reference states.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] states Cartesian states.
+             * @param[in] reference Reference Cartesian states.
+             */
+            void add(const std::vector<std::vector<T>>& states, const std::vector<std::vector<T>>& reference);
+
+            /**
+             * @brief Combine the samples of another accumulator.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] other Accumulator.
+             */
+            void merge(const ErrorAccumulator<T>& other);
+
+            /**
+             * @brief Calculate the error statistics of the samples added so far.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return ErrorStatistics<T> Error statistics.
+             */
+            ErrorStatistics<T> statistics() const;
+
+    };
+
+    /**
+     * @brief Calculate the error statistics of a set of Cartesian states against reference states.
+     * 
+     * @note If more than one thread is requested, the samples are split into contiguous ranges and accumulated across a thread pool.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] states Cartesian states.
+     * @param[in] reference Reference Cartesian states.
+     * @param[in] threads Number of threads (serial if less than two).
+     * @return ErrorStatistics<T> Error statistics.
+     */
+    template<class T>
+    ErrorStatistics<T> error_statistics(const std::vector<std::vector<T>>& states, const std::vector<std::vector<T>>& reference, const unsigned int threads = 0);
+
+    /**
+     * @brief Get the header of the CSV format of error statistics.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @return std::string Comma-separated column names.
+     */
+    std::string csv_header();
+
+    /**
+     * @brief Format error statistics as a CSV row.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] statistics Error statistics.
+     * @return std::string Comma-separated values, in the order of the header.
+     */
+    template<class T>
+    std::string csv_row(const ErrorStatistics<T>& statistics);
+
+}
+
+#endif
\ No newline at end of file
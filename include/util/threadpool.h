@@ -0,0 +1,208 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef THAMES_UTIL_THREADPOOL
+#define THAMES_UTIL_THREADPOOL
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace thames::util::threadpool {
+
+    /**
+     * @brief Work-stealing thread pool.
+     * 
+     * Each worker owns a queue of tasks, taking new work from the back of its own queue and stealing from the front of the other queues once its own queue is empty.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    class WorkStealingPool {
+
+        protected:
+
+            /// Structure to store a task queue
+            struct TaskQueue {
+                /// Mutex guarding the queue
+                std::mutex mutex;
+                /// Queued tasks
+                std::deque<std::function<void()>> tasks;
+            };
+
+            /// Task queues for each worker
+            std::vector<std::unique_ptr<TaskQueue>> m_queues;
+
+            /// Worker threads
+            std::vector<std::thread> m_threads;
+
+            /// Mutex guarding the counters and flags
+            std::mutex m_mutex;
+
+            /// Condition variable to wake workers when tasks are queued
+            std::condition_variable m_queuedCondition;
+
+            /// Condition variable to signal that all tasks are complete
+            std::condition_variable m_completeCondition;
+
+            /// Number of queued tasks
+            std::size_t m_queued = 0;
+
+            /// Number of incomplete tasks
+            std::size_t m_pending = 0;
+
+            /// Index of the next queue for submission
+            std::size_t m_next = 0;
+
+            /// Flag for whether the workers should stop
+            bool m_stop = false;
+
+            /// First exception raised by a task
+            std::exception_ptr m_exception;
+
+            /**
+             * @brief Worker loop.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] index Worker index.
+             */
+            void worker(const std::size_t index);
+
+            /**
+             * @brief Take a task from the worker's own queue, or steal from another queue.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] index Worker index.
+             * @param[out] task Task.
+             * @return bool Flag for whether a task was found.
+             */
+            bool pop(const std::size_t index, std::function<void()>& task);
+
+        public:
+
+            /**
+             * @brief Construct a new Work Stealing Pool object.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] nthreads Number of worker threads (hardware concurrency if zero).
+             */
+            WorkStealingPool(const unsigned int nthreads = 0);
+
+            /**
+             * @brief Destroy the Work Stealing Pool object, after completing all queued tasks.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            ~WorkStealingPool();
+
+            WorkStealingPool(const WorkStealingPool&) = delete;
+            WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+            /**
+             * @brief Submit a task to the pool.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] task Task.
+             */
+            void submit(std::function<void()> task);
+
+            /**
+             * @brief Wait for all submitted tasks to complete.
+             * 
+             * Rethrows the first exception raised by a task, if any.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             */
+            void wait();
+
+            /**
+             * @brief Run a loop across the pool, with the calling thread taking part.
+             * 
+             * Iterations are claimed in turn by the calling thread and up to one helper task per worker, and the call returns once every iteration is complete. Only the helper tasks of this loop are waited for, so the pool may be shared with other callers. Rethrows the first exception raised by an iteration, if any.
+             * 
+             * @note If called from a worker of any pool, the loop runs in the calling thread to avoid oversubscribing the hardware threads.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @param[in] n Number of iterations.
+             * @param[in] body Loop body, called with the index of each iteration.
+             */
+            void parallel_for(const std::size_t n, const std::function<void(const std::size_t)>& body);
+
+            /**
+             * @brief Get the number of worker threads.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return std::size_t Number of worker threads.
+             */
+            std::size_t size() const;
+
+            /**
+             * @brief Retrieve the process-wide pool, with one worker per hardware thread.
+             * 
+             * The pool is created on first use.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return WorkStealingPool& Process-wide pool.
+             */
+            static WorkStealingPool& shared();
+
+            /**
+             * @brief Check whether the calling thread is a worker of any pool.
+             * 
+             * @author Max Hallgarten La Casta
+             * @date 2026-10-19
+             * 
+             * @return bool Flag for whether the calling thread is a worker.
+             */
+            static bool is_worker();
+
+    };
+
+}
+
+#endif
\ No newline at end of file
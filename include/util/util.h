@@ -26,9 +26,15 @@ SOFTWARE.
 #define THAMES_UTIL
 
 #include "angles.h"
+#include "covariance.h"
 #include "optimise.h"
+#include "pipeline.h"
 #include "polynomials.h"
+#include "powers.h"
+#include "profiling.h"
 #include "root.h"
 #include "sampling.h"
+#include "statistics.h"
+#include "threadpool.h"
 
 #endif
\ No newline at end of file
@@ -57,6 +57,8 @@ namespace thames::conversions::dimensional {
         return RVnd;
     }
     template std::vector<double> cartesian_nondimensionalise(const std::vector<double>&, const DimensionalFactors<double>&);
+    template std::vector<float> cartesian_nondimensionalise(const std::vector<float>&, const DimensionalFactors<float>&);
+    template std::vector<long double> cartesian_nondimensionalise(const std::vector<long double>&, const DimensionalFactors<long double>&);
 
     template<class T>
     std::vector<T> cartesian_dimensionalise(const std::vector<T>& RVnd, const DimensionalFactors<T>& factors){
@@ -75,6 +77,8 @@ namespace thames::conversions::dimensional {
         return RV;
     }
     template std::vector<double> cartesian_dimensionalise(const std::vector<double>&, const DimensionalFactors<double>&);
+    template std::vector<float> cartesian_dimensionalise(const std::vector<float>&, const DimensionalFactors<float>&);
+    template std::vector<long double> cartesian_dimensionalise(const std::vector<long double>&, const DimensionalFactors<long double>&);
 
     template<class T>
     std::vector<T> geqoe_nondimensionalise(const std::vector<T>& geqoe, const DimensionalFactors<T>& factors){
@@ -88,6 +92,8 @@ namespace thames::conversions::dimensional {
         return geqoend;
     }
     template std::vector<double> geqoe_nondimensionalise(const std::vector<double>&, const DimensionalFactors<double>&);
+    template std::vector<float> geqoe_nondimensionalise(const std::vector<float>&, const DimensionalFactors<float>&);
+    template std::vector<long double> geqoe_nondimensionalise(const std::vector<long double>&, const DimensionalFactors<long double>&);
 
     template<class T>
     std::vector<T> geqoe_dimensionalise(const std::vector<T>& geqoend, const DimensionalFactors<T>& factors){
@@ -101,6 +107,8 @@ namespace thames::conversions::dimensional {
         return geqoe;
     }
     template std::vector<double> geqoe_dimensionalise(const std::vector<double>&, const DimensionalFactors<double>&);
+    template std::vector<float> geqoe_dimensionalise(const std::vector<float>&, const DimensionalFactors<float>&);
+    template std::vector<long double> geqoe_dimensionalise(const std::vector<long double>&, const DimensionalFactors<long double>&);
 
     template<class T>
     DimensionalFactors<T> calculate_factors(const std::vector<T>& RV, const T& mu){
@@ -131,6 +139,8 @@ namespace thames::conversions::dimensional {
         return factors;
     }
     template DimensionalFactors<double> calculate_factors(const std::vector<double>&, const double&);
+    template DimensionalFactors<float> calculate_factors(const std::vector<float>&, const float&);
+    template DimensionalFactors<long double> calculate_factors(const std::vector<long double>&, const long double&);
 
     /////////////////
     // Polynomials //
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "../../include/conversions/geqoe.h"
 #include "../../include/conversions/keplerian.h"
 #include "../../include/perturbations/baseperturbation.h"
+#include "../../include/util/powers.h"
 #include "../../include/util/root.h"
 #include "../../include/vector/arithmeticoverloads.h"
 #include "../../include/vector/geometry.h"
@@ -43,6 +44,8 @@ namespace thames::conversions::geqoe{
 
     using namespace thames::perturbations::baseperturbation;
     using namespace thames::vector::arithmeticoverloads;
+    using thames::util::powers::cbrt;
+    using thames::util::powers::ipow;
 
     ///////////
     // Reals //
@@ -63,29 +66,29 @@ namespace thames::conversions::geqoe{
         T h = thames::vector::geometry::norm3(H);
 
         // Calculate the effective potential energy
-        T ueff = pow(h, 2.0)/(2.0*pow(r, 2.0)) + perturbation->potential(t, R);
+        T ueff = ipow<2>(h)/(2.0*ipow<2>(r)) + perturbation->potential(t, R);
 
         // Calculate the total energy
-        T e = 0.5*pow(drdt, 2.0) - mu/r + ueff;
+        T e = 0.5*ipow<2>(drdt) - mu/r + ueff;
 
         // Calculate the generalised mean motion
-        T nu = pow(-2.0*e, 1.5)/mu;
+        T nu = -2.0*e*sqrt(-2.0*e)/mu;
 
         // Calculate plane orientation parameters
         T q1 = H[0]/(h + H[2]);
         T q2 = -H[1]/(h + H[2]);
 
         // Calculate equinocital reference frame unit vectors
-        T efac = 1.0/(1.0 + pow(q1, 2.0) + pow(q2, 2.0));
+        T efac = 1.0/(1.0 + ipow<2>(q1) + ipow<2>(q2));
         std::vector<T> ex = {
-            efac*(1.0 - pow(q1, 2.0) + pow(q2, 2.0)),
-            efac*(2.0*q1*q2),
-            efac*(-2.0*q1)
+            T(efac*(1.0 - ipow<2>(q1) + ipow<2>(q2))),
+            T(efac*(2.0*q1*q2)),
+            T(efac*(-2.0*q1))
         };
         std::vector<T> ey = {
-            efac*(2.0*q1*q2),
-            efac*(1.0 + pow(q1, 2.0) - pow(q2, 2.0)),
-            efac*(2.0*q2)
+            T(efac*(2.0*q1*q2)),
+            T(efac*(1.0 + ipow<2>(q1) - ipow<2>(q2))),
+            T(efac*(2.0*q2))
         };
 
         // Calculate radial unit vector
@@ -96,10 +99,10 @@ namespace thames::conversions::geqoe{
         T sl = thames::vector::geometry::dot3(er, ey);
 
         // Calculate the generalised angular momentum
-        T c = sqrt(2.0*pow(r, 2.0)*ueff);
+        T c = sqrt(2.0*ipow<2>(r)*ueff);
 
         // Calculate the generalised semi-latus rectum
-        T p = pow(c, 2.0)/mu;
+        T p = ipow<2>(c)/mu;
 
         // Calculate remaining non-osculating ellipse parameters
         T pfac1 = (p/r - 1.0);
@@ -108,11 +111,11 @@ namespace thames::conversions::geqoe{
         T p2 = pfac1*cl + pfac2*sl;
 
         // Calculate generalised semi-major axis and velocity
-        T a = pow(mu/pow(nu, 2.0), 1.0/3.0);
+        T a = cbrt(mu/ipow<2>(nu));
         T w = sqrt(mu/a);
 
         // Calculate generalised mean longitude
-        T SCfac1 = mu + c*w - r*pow(drdt, 2.0);
+        T SCfac1 = mu + c*w - r*ipow<2>(drdt);
         T SCfac2 = drdt*(c + w*r);
         T S = SCfac1*sl - SCfac2*cl;
         T C = SCfac1*cl + SCfac2*sl;
@@ -132,6 +135,8 @@ namespace thames::conversions::geqoe{
         return geqoe;
     }
     template std::vector<double> cartesian_to_geqoe<double>(const double& t, const std::vector<double>& RV, const double& mu, const std::shared_ptr<const BasePerturbation<double>> perturbation);
+    template std::vector<float> cartesian_to_geqoe<float>(const float& t, const std::vector<float>& RV, const float& mu, const std::shared_ptr<const BasePerturbation<float>> perturbation);
+    template std::vector<long double> cartesian_to_geqoe<long double>(const long double& t, const std::vector<long double>& RV, const long double& mu, const std::shared_ptr<const BasePerturbation<long double>> perturbation);
 
     template<class T>
     std::vector<T> geqoe_to_cartesian(const T& t, const std::vector<T>& geqoe, const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation){
@@ -144,35 +149,37 @@ namespace thames::conversions::geqoe{
         T q2 = geqoe[5];
 
         // Calculate generalised eccentric longitude
-        std::function<double (double)> fk = [p1, p2, L](T k) {return (k + p1*cos(k) - p2*sin(k) - L);};
-        std::function<double (double)> dfk = [p1, p2, L](T k) {return (1 - p1*sin(k) - p2*cos(k));};
+        std::function<T (T)> fk = [p1, p2, L](T k) {return (k + p1*cos(k) - p2*sin(k) - L);};
+        std::function<T (T)> dfk = [p1, p2, L](T k) {return (1 - p1*sin(k) - p2*cos(k));};
         T k = thames::util::root::newton_raphson(fk, dfk, L);
         T sink = sin(k);
         T cosk = cos(k);
 
         // Calculate generalised semi-major axis
-        T a = pow(mu/pow(nu, 2.0), 1.0/3.0);
+        T a = cbrt(mu/ipow<2>(nu));
+        T sqrtmua = sqrt(mu*a);
 
         // Calculate range and range rate
         T r = a*(1.0 - p1*sink - p2*cosk);
-        T drdt = sqrt(mu*a)/r*(p2*sink - p1*cosk);
+        T drdt = sqrtmua/r*(p2*sink - p1*cosk);
 
         // Calculate trig of the true longitude
-        T alpha = 1.0/(1.0 + sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0)));
-        T sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*pow(p2, 2.0))*sink - p1);
-        T cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*pow(p1, 2.0))*cosk - p2);
+        T beta = sqrt(1.0 - ipow<2>(p1) - ipow<2>(p2));
+        T alpha = 1.0/(1.0 + beta);
+        T sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*ipow<2>(p2))*sink - p1);
+        T cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*ipow<2>(p1))*cosk - p2);
 
         // Calculate equinocital reference frame unit vectors
-        T efac = 1.0/(1.0 + pow(q1, 2.0) + pow(q2, 2.0));
+        T efac = 1.0/(1.0 + ipow<2>(q1) + ipow<2>(q2));
         std::vector<T> ex = {
-            efac*(1.0 - pow(q1, 2.0) + pow(q2, 2.0)),
-            efac*(2.0*q1*q2),
-            efac*(-2.0*q1)
+            T(efac*(1.0 - ipow<2>(q1) + ipow<2>(q2))),
+            T(efac*(2.0*q1*q2)),
+            T(efac*(-2.0*q1))
         };
         std::vector<T> ey = {
-            efac*(2.0*q1*q2),
-            efac*(1.0 + pow(q1, 2.0) - pow(q2, 2.0)),
-            efac*(2.0*q2)
+            T(efac*(2.0*q1*q2)),
+            T(efac*(1.0 + ipow<2>(q1) - ipow<2>(q2))),
+            T(efac*(2.0*q2))
         };
 
         // Calculate orbital basis vectors
@@ -183,10 +190,10 @@ namespace thames::conversions::geqoe{
         std::vector<T> R = r*er;
 
         // Calculate generalised angular momentum
-        T c = pow(pow(mu, 2.0)/nu, 1.0/3.0)*sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0));
+        T c = sqrtmua*beta;
 
         // Calculate angular momentum
-        T h = sqrt(pow(c, 2.0) - 2.0*pow(r, 2.0)*perturbation->potential(t, R));
+        T h = sqrt(ipow<2>(c) - 2.0*ipow<2>(r)*perturbation->potential(t, R));
 
         // Calculate velocity
         std::vector<T> V = drdt*er + h/r*ef;
@@ -205,6 +212,8 @@ namespace thames::conversions::geqoe{
         return RV;
     }
     template std::vector<double> geqoe_to_cartesian<double>(const double&, const std::vector<double>&, const double&, const std::shared_ptr<const BasePerturbation<double>> perturbation);
+    template std::vector<float> geqoe_to_cartesian<float>(const float&, const std::vector<float>&, const float&, const std::shared_ptr<const BasePerturbation<float>> perturbation);
+    template std::vector<long double> geqoe_to_cartesian<long double>(const long double&, const std::vector<long double>&, const long double&, const std::shared_ptr<const BasePerturbation<long double>> perturbation);
 
     /////////////////
     // Polynomials //
@@ -229,28 +238,28 @@ namespace thames::conversions::geqoe{
         P<T> h = thames::vector::geometry::norm3(H);
 
         // Calculate the effective potential energy
-        P<T> ueff = pow(h, 2.0)/(2.0*pow(r, 2.0)) + perturbation->potential(t, R);
+        P<T> ueff = ipow<2>(h)/(2.0*ipow<2>(r)) + perturbation->potential(t, R);
 
         // Calculate the total energy
-        P<T> e = 0.5*pow(drdt, 2.0) - mu/r + ueff;
+        P<T> e = 0.5*ipow<2>(drdt) - mu/r + ueff;
 
         // Calculate the generalised mean motion
-        P<T> nu = pow(-2.0*e, 1.5)/mu;
+        P<T> nu = -2.0*e*sqrt(-2.0*e)/mu;
 
         // Calculate plane orientation parameters
         P<T> q1 = H[0]/(h + H[2]);
         P<T> q2 = -H[1]/(h + H[2]);
 
         // Calculate equinocital reference frame unit vectors
-        P<T> efac = 1.0/(1.0 + pow(q1, 2.0) + pow(q2, 2.0));
+        P<T> efac = 1.0/(1.0 + ipow<2>(q1) + ipow<2>(q2));
         std::vector<P<T>> ex = {
-            efac*(1.0 - pow(q1, 2.0) + pow(q2, 2.0)),
+            efac*(1.0 - ipow<2>(q1) + ipow<2>(q2)),
             efac*(2.0*q1*q2),
             efac*(-2.0*q1)
         };
         std::vector<P<T>> ey = {
             efac*(2.0*q1*q2),
-            efac*(1.0 + pow(q1, 2.0) - pow(q2, 2.0)),
+            efac*(1.0 + ipow<2>(q1) - ipow<2>(q2)),
             efac*(2.0*q2)
         };
 
@@ -262,10 +271,10 @@ namespace thames::conversions::geqoe{
         P<T> sl = thames::vector::geometry::dot3(er, ey);
 
         // Calculate the generalised angular momentum
-        P<T> c = sqrt(2.0*pow(r, 2.0)*ueff);
+        P<T> c = sqrt(2.0*ipow<2>(r)*ueff);
 
         // Calculate the generalised semi-latus rectum
-        P<T> p = pow(c, 2.0)/mu;
+        P<T> p = ipow<2>(c)/mu;
 
         // Calculate remaining non-osculating ellipse parameters
         P<T> pfac1 = (p/r - 1.0);
@@ -274,11 +283,11 @@ namespace thames::conversions::geqoe{
         P<T> p2 = pfac1*cl + pfac2*sl;
 
         // Calculate generalised semi-major axis and velocity
-        P<T> a = pow(mu/pow(nu, 2.0), 1.0/3.0);
+        P<T> a = cbrt(mu/ipow<2>(nu));
         P<T> w = sqrt(mu/a);
 
         // Calculate generalised mean longitude
-        P<T> SCfac1 = mu + c*w - r*pow(drdt, 2.0);
+        P<T> SCfac1 = mu + c*w - r*ipow<2>(drdt);
         P<T> SCfac2 = drdt*(c + w*r);
         P<T> S = SCfac1*sl - SCfac2*cl;
         P<T> C = SCfac1*cl + SCfac2*sl;
@@ -318,27 +327,29 @@ namespace thames::conversions::geqoe{
         P<T> cosk = cos(k);
 
         // Calculate generalised semi-major axis
-        P<T> a = pow(mu/pow(nu, 2.0), 1.0/3.0);
+        P<T> a = cbrt(mu/ipow<2>(nu));
+        P<T> sqrtmua = sqrt(mu*a);
 
         // Calculate range and range rate
         P<T> r = a*(1.0 - p1*sink - p2*cosk);
-        P<T> drdt = sqrt(mu*a)/r*(p2*sink - p1*cosk);
+        P<T> drdt = sqrtmua/r*(p2*sink - p1*cosk);
 
         // Calculate trig of the true longitude
-        P<T> alpha = 1.0/(1.0 + sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0)));
-        P<T> sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*pow(p2, 2.0))*sink - p1);
-        P<T> cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*pow(p1, 2.0))*cosk - p2);
+        P<T> beta = sqrt(1.0 - ipow<2>(p1) - ipow<2>(p2));
+        P<T> alpha = 1.0/(1.0 + beta);
+        P<T> sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*ipow<2>(p2))*sink - p1);
+        P<T> cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*ipow<2>(p1))*cosk - p2);
 
         // Calculate equinocital reference frame unit vectors
-        P<T> efac = 1.0/(1.0 + pow(q1, 2.0) + pow(q2, 2.0));
+        P<T> efac = 1.0/(1.0 + ipow<2>(q1) + ipow<2>(q2));
         std::vector<P<T>> ex = {
-            efac*(1.0 - pow(q1, 2.0) + pow(q2, 2.0)),
+            efac*(1.0 - ipow<2>(q1) + ipow<2>(q2)),
             efac*(2.0*q1*q2),
             efac*(-2.0*q1)
         };
         std::vector<P<T>> ey = {
             efac*(2.0*q1*q2),
-            efac*(1.0 + pow(q1, 2.0) - pow(q2, 2.0)),
+            efac*(1.0 + ipow<2>(q1) - ipow<2>(q2)),
             efac*(2.0*q2)
         };
 
@@ -350,10 +361,10 @@ namespace thames::conversions::geqoe{
         std::vector<P<T>> R = r*er;
 
         // Calculate generalised angular momentum
-        P<T> c = pow(pow(mu, 2.0)/nu, 1.0/3.0)*sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0));
+        P<T> c = sqrtmua*beta;
 
         // Calculate angular momentum
-        P<T> h = sqrt(pow(c, 2.0) - 2.0*pow(r, 2.0)*perturbation->potential(t, R));
+        P<T> h = sqrt(ipow<2>(c) - 2.0*ipow<2>(r)*perturbation->potential(t, R));
 
         // Calculate velocity
         std::vector<P<T>> V = drdt*er + h/r*ef;
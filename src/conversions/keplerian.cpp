@@ -134,6 +134,8 @@ namespace thames::conversions::keplerian {
         return keplerian;
     }
     template std::vector<double> cartesian_to_keplerian<double>(const std::vector<double>&, const double&);
+    template std::vector<float> cartesian_to_keplerian<float>(const std::vector<float>&, const float&);
+    template std::vector<long double> cartesian_to_keplerian<long double>(const std::vector<long double>&, const long double&);
 
     template<class T>
     std::vector<T> keplerian_to_cartesian(const std::vector<T>& keplerian, const T& mu){
@@ -166,8 +168,8 @@ namespace thames::conversions::keplerian {
 
         T fac = sqrt(mu*sma)/r;
         std::vector<T> dodt = {
-            -fac*sin(E),
-            fac*sqrt(1.0 - pow(e, 2.0))*cos(E),
+            T(-fac*sin(E)),
+            T(fac*sqrt(1.0 - pow(e, 2.0))*cos(E)),
             0.0
         };
 
@@ -191,5 +193,7 @@ namespace thames::conversions::keplerian {
         return RV;
     }
     template std::vector<double> keplerian_to_cartesian<double>(const std::vector<double>&, const double&);
+    template std::vector<float> keplerian_to_cartesian<float>(const std::vector<float>&, const float&);
+    template std::vector<long double> keplerian_to_cartesian<long double>(const std::vector<long double>&, const long double&);
 
 }
\ No newline at end of file
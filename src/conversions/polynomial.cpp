@@ -29,6 +29,7 @@ SOFTWARE.
 #endif
 
 #include "../../include/conversions/polynomial.h"
+#include "../../include/util/polynomials.h"
 
 namespace thames::conversions::polynomial {
  
@@ -106,13 +107,13 @@ namespace thames::conversions::polynomial {
         // Calculate number of state variables
         unsigned int n = state.size();
 
+        // Initialise fast multiplication, if not already initialised for this size
+        thames::util::polynomials::initialise_multiplication_table<T, P>(n, degree);
+
         // Iterate through state variables
         for(unsigned int ii=0; ii<n; ii++){
             // Generate polynomial
             statepolynomial.push_back(P<T>(n, degree, ii, state[ii]-stateunc[ii], state[ii]+stateunc[ii]));
-
-            // Initialise fast multiplication
-            statepolynomial[ii].initialize_M(n, degree);  
         }
     }
     template void states_to_polynomial(const std::vector<double>&, const std::vector<double>&, int, std::vector<taylor_polynomial<double>>&);
@@ -129,13 +130,13 @@ namespace thames::conversions::polynomial {
         // Calculate number of state variables
         unsigned int n = states[0].size();
 
+        // Initialise fast multiplication, if not already initialised for this size
+        thames::util::polynomials::initialise_multiplication_table<T, P>(n, degree);
+
         // Iterate through Cartesian state variables
         for(unsigned int ii=0; ii<n; ii++){
             // Generate polynomial
             statepolynomial.push_back(P<T>(n, degree, ii, lower[ii], upper[ii]));
-
-            // Initialise fast multiplication
-            statepolynomial[ii].initialize_M(n, degree);  
         }
     }
     template void states_to_polynomial(const std::vector<std::vector<double>>&, int, std::vector<taylor_polynomial<double>>&, std::vector<double>&, std::vector<double>&);
@@ -36,6 +36,7 @@ SOFTWARE.
 #include "../../include/conversions/keplerian.h"
 #include "../../include/conversions/universal.h"
 #include "../../include/perturbations/baseperturbation.h"
+#include "../../include/util/profiling.h"
 
 namespace thames::conversions::universal {
 
@@ -56,6 +57,9 @@ namespace thames::conversions::universal {
         if (statetype1 == statetype2)
             return state;
 
+        // Time conversion
+        thames::util::profiling::ScopedTimer timer("convert_state");
+
         // Cartesian -> GEqOE
         if (statetype1 == CARTESIAN && statetype2 == GEQOE)
             return thames::conversions::geqoe::cartesian_to_geqoe(t, state, mu, perturbation);
@@ -76,6 +80,8 @@ namespace thames::conversions::universal {
         throw std::runtime_error("Unsupported state conversion");
     }
     template std::vector<double> convert_state(const double&, const std::vector<double>&, const double&, const StateTypes&, const StateTypes&, const std::shared_ptr<const BasePerturbation<double>> perturbation);
+    template std::vector<float> convert_state(const float&, const std::vector<float>&, const float&, const StateTypes&, const StateTypes&, const std::shared_ptr<const BasePerturbation<float>> perturbation);
+    template std::vector<long double> convert_state(const long double&, const std::vector<long double>&, const long double&, const StateTypes&, const StateTypes&, const std::shared_ptr<const BasePerturbation<long double>> perturbation);
 
     template<class T>
     std::vector<T> nondimensionalise_state(const std::vector<T>& state, const StateTypes& statetype, const DimensionalFactors<T>& factors) {
@@ -95,6 +101,8 @@ namespace thames::conversions::universal {
         }
     }
     template std::vector<double> nondimensionalise_state(const std::vector<double>& state, const StateTypes& statetype, const DimensionalFactors<double>& factors);
+    template std::vector<float> nondimensionalise_state(const std::vector<float>& state, const StateTypes& statetype, const DimensionalFactors<float>& factors);
+    template std::vector<long double> nondimensionalise_state(const std::vector<long double>& state, const StateTypes& statetype, const DimensionalFactors<long double>& factors);
 
     template<class T>
     std::vector<T> dimensionalise_state(const std::vector<T>& statend, const StateTypes& statetype, const DimensionalFactors<T>& factors) {
@@ -114,6 +122,8 @@ namespace thames::conversions::universal {
         }
     }
     template std::vector<double> dimensionalise_state(const std::vector<double>& statend, const StateTypes& statetype, const DimensionalFactors<double>& factors);
+    template std::vector<float> dimensionalise_state(const std::vector<float>& statend, const StateTypes& statetype, const DimensionalFactors<float>& factors);
+    template std::vector<long double> dimensionalise_state(const std::vector<long double>& statend, const StateTypes& statetype, const DimensionalFactors<long double>& factors);
 
     /////////////////
     // Polynomials //
@@ -131,6 +141,9 @@ namespace thames::conversions::universal {
         if (statetype1 == statetype2)
             return state;
 
+        // Time conversion
+        thames::util::profiling::ScopedTimer timer("convert_state");
+
         // Cartesian -> GEqOE
         if (statetype1 == CARTESIAN && statetype2 == GEQOE)
             return thames::conversions::geqoe::cartesian_to_geqoe(t, state, mu, perturbation);
@@ -0,0 +1,265 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../../include/io/binary.h"
+
+namespace thames::io::binary {
+
+    // NumPy file magic string
+    const char NPY_MAGIC[] = "\x93NUMPY";
+    const std::size_t NPY_MAGIC_SIZE = 6;
+
+    // Release mapped pages fully contained in a byte range
+    void release_pages(void* map, const std::size_t begin, const std::size_t end) {
+        // Round range inwards to page boundaries
+        const std::size_t page = (std::size_t) sysconf(_SC_PAGESIZE);
+        const std::size_t first = (begin + page - 1)/page*page;
+        const std::size_t last = end/page*page;
+
+        // Release pages
+        if (last > first)
+            madvise(static_cast<char*>(map) + first, last - first, MADV_DONTNEED);
+    }
+
+    // Parse the header of a NumPy file, returning the data offset and number of rows
+    std::size_t parse_npy_header(const char* data, const std::size_t size, const std::size_t dimension, std::size_t& rows) {
+        // Check magic string and version
+        if (size < NPY_MAGIC_SIZE + 4 || std::memcmp(data, NPY_MAGIC, NPY_MAGIC_SIZE) != 0)
+            throw std::runtime_error("Invalid NumPy state file");
+        const unsigned char major = (unsigned char) data[6];
+
+        // Read header length
+        std::size_t headersize, headerlength;
+        if (major == 1) {
+            headersize = 10;
+            headerlength = (unsigned char) data[8] | ((std::size_t) (unsigned char) data[9] << 8);
+        } else if (major == 2 || major == 3) {
+            headersize = 12;
+            if (size < headersize)
+                throw std::runtime_error("Invalid NumPy state file");
+            headerlength = 0;
+            for (std::size_t ii = 0; ii < 4; ii++)
+                headerlength |= (std::size_t) (unsigned char) data[8 + ii] << (8*ii);
+        } else {
+            throw std::runtime_error("Unsupported NumPy state file version");
+        }
+        if (headersize + headerlength > size)
+            throw std::runtime_error("Invalid NumPy state file");
+        const std::string header(data + headersize, headerlength);
+
+        // Check data type and ordering
+        if (header.find("'descr': '<f8'") == std::string::npos)
+            throw std::runtime_error("NumPy state file must contain little-endian 64-bit floats");
+        if (header.find("'fortran_order': False") == std::string::npos)
+            throw std::runtime_error("NumPy state file must be in C order");
+
+        // Read shape
+        const std::size_t shapestart = header.find("'shape': (");
+        if (shapestart == std::string::npos)
+            throw std::runtime_error("Invalid NumPy state file");
+        const char* shape = header.c_str() + shapestart + 10;
+        char* shapeend;
+        rows = std::strtoull(shape, &shapeend, 10);
+        while (*shapeend == ',' || *shapeend == ' ')
+            shapeend++;
+        const std::size_t columns = std::strtoull(shapeend, nullptr, 10);
+        if (columns != dimension)
+            throw std::runtime_error("NumPy state file has an inconsistent state dimension");
+
+        // Return data offset
+        return headersize + headerlength;
+    }
+
+    template<class T>
+    StateFileReader<T>::StateFileReader(const std::string& filepath, const std::size_t dimension) : m_dimension(dimension) {
+        // Open file
+        m_file = open(filepath.c_str(), O_RDONLY);
+        if (m_file < 0)
+            throw std::runtime_error("Unable to open state file: " + filepath);
+
+        // Retrieve file size
+        struct stat status;
+        if (fstat(m_file, &status) != 0 || status.st_size == 0) {
+            close(m_file);
+            throw std::runtime_error("Unable to read state file: " + filepath);
+        }
+        m_mapSize = (std::size_t) status.st_size;
+
+        // Map file
+        m_map = mmap(nullptr, m_mapSize, PROT_READ, MAP_PRIVATE, m_file, 0);
+        if (m_map == MAP_FAILED) {
+            close(m_file);
+            throw std::runtime_error("Unable to map state file: " + filepath);
+        }
+        madvise(m_map, m_mapSize, MADV_SEQUENTIAL);
+
+        try {
+            // Locate data according to the file format
+            const std::size_t rowsize = m_dimension*sizeof(double);
+            if (m_mapSize >= NPY_MAGIC_SIZE && std::memcmp(m_map, NPY_MAGIC, NPY_MAGIC_SIZE) == 0) {
+                m_offset = parse_npy_header(static_cast<const char*>(m_map), m_mapSize, m_dimension, m_size);
+                if (m_offset + m_size*rowsize > m_mapSize)
+                    throw std::runtime_error("NumPy state file is truncated");
+            } else {
+                if (m_mapSize % rowsize != 0)
+                    throw std::runtime_error("Raw state file size is not a multiple of the state size");
+                m_size = m_mapSize/rowsize;
+            }
+        } catch (...) {
+            munmap(m_map, m_mapSize);
+            close(m_file);
+            throw;
+        }
+    }
+
+    template<class T>
+    StateFileReader<T>::~StateFileReader() {
+        // Unmap and close file
+        munmap(m_map, m_mapSize);
+        close(m_file);
+    }
+
+    template<class T>
+    std::size_t StateFileReader<T>::size() const {
+        return m_size;
+    }
+
+    template<class T>
+    std::vector<std::vector<T>> StateFileReader<T>::read(const std::size_t start, const std::size_t count) const {
+        // Check range
+        if (start + count > m_size)
+            throw std::runtime_error("State range exceeds state file");
+
+        // Copy states from the map
+        const char* data = static_cast<const char*>(m_map) + m_offset;
+        std::vector<std::vector<T>> states(count, std::vector<T>(m_dimension));
+        double value;
+        for (std::size_t ii = 0; ii < count; ii++) {
+            for (std::size_t jj = 0; jj < m_dimension; jj++) {
+                std::memcpy(&value, data + ((start + ii)*m_dimension + jj)*sizeof(double), sizeof(double));
+                states[ii][jj] = (T) value;
+            }
+        }
+
+        // Release pages which have been read
+        release_pages(m_map, m_offset + start*m_dimension*sizeof(double), m_offset + (start + count)*m_dimension*sizeof(double));
+
+        // Return states
+        return states;
+    }
+
+    template class StateFileReader<double>;
+    template class StateFileReader<float>;
+    template class StateFileReader<long double>;
+
+    template<class T>
+    StateFileWriter<T>::StateFileWriter(const std::string& filepath, const std::size_t size, const std::size_t dimension) : m_size(size), m_dimension(dimension) {
+        // Construct header, padded so that the data is aligned
+        std::string header = "{'descr': '<f8', 'fortran_order': False, 'shape': (" + std::to_string(m_size) + ", " + std::to_string(m_dimension) + "), }";
+        const std::size_t headersize = NPY_MAGIC_SIZE + 4;
+        header.append(64 - (headersize + header.size() + 1) % 64, ' ');
+        header.push_back('\n');
+        if (header.size() > UINT16_MAX)
+            throw std::runtime_error("NumPy state file header is too long");
+        m_offset = headersize + header.size();
+
+        // Create file
+        m_file = open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m_file < 0)
+            throw std::runtime_error("Unable to create state file: " + filepath);
+
+        // Size file
+        m_mapSize = m_offset + m_size*m_dimension*sizeof(double);
+        if (ftruncate(m_file, (off_t) m_mapSize) != 0) {
+            close(m_file);
+            throw std::runtime_error("Unable to size state file: " + filepath);
+        }
+
+        // Map file
+        m_map = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+        if (m_map == MAP_FAILED) {
+            close(m_file);
+            throw std::runtime_error("Unable to map state file: " + filepath);
+        }
+
+        // Write header
+        char* data = static_cast<char*>(m_map);
+        std::memcpy(data, NPY_MAGIC, NPY_MAGIC_SIZE);
+        data[6] = 1;
+        data[7] = 0;
+        data[8] = (char) (header.size() & 0xFF);
+        data[9] = (char) ((header.size() >> 8) & 0xFF);
+        std::memcpy(data + headersize, header.data(), header.size());
+    }
+
+    template<class T>
+    StateFileWriter<T>::~StateFileWriter() {
+        // Flush, unmap and close file
+        msync(m_map, m_mapSize, MS_SYNC);
+        munmap(m_map, m_mapSize);
+        close(m_file);
+    }
+
+    template<class T>
+    void StateFileWriter<T>::write(const std::size_t start, const std::vector<std::vector<T>>& states) {
+        // Check range
+        if (start + states.size() > m_size)
+            throw std::runtime_error("State range exceeds state file");
+
+        // Copy states into the map
+        char* data = static_cast<char*>(m_map) + m_offset;
+        double value;
+        for (std::size_t ii = 0; ii < states.size(); ii++) {
+            if (states[ii].size() != m_dimension)
+                throw std::runtime_error("State has an inconsistent dimension");
+            for (std::size_t jj = 0; jj < m_dimension; jj++) {
+                value = (double) states[ii][jj];
+                std::memcpy(data + ((start + ii)*m_dimension + jj)*sizeof(double), &value, sizeof(double));
+            }
+        }
+
+        // Start write-back and release pages which have been written
+        const std::size_t begin = m_offset + start*m_dimension*sizeof(double);
+        const std::size_t end = m_offset + (start + states.size())*m_dimension*sizeof(double);
+        const std::size_t page = (std::size_t) sysconf(_SC_PAGESIZE);
+        msync(static_cast<char*>(m_map) + begin/page*page, end - begin/page*page, MS_ASYNC);
+        release_pages(m_map, begin, end);
+    }
+
+    template class StateFileWriter<double>;
+    template class StateFileWriter<float>;
+    template class StateFileWriter<long double>;
+
+}
\ No newline at end of file
@@ -22,18 +22,28 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <cstdint>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
 #include "../../include/io/json.h"
+#include "../../include/propagators/flowmap.h"
 #include "../../include/settings/settings.h"
 
 namespace thames::io::json {
 
+    // JSON type storing numbers in the numeric type of the parameters, so that long double inputs are not rounded to double when parsed
+    template<class T>
+    using basic_json = nlohmann::basic_json<std::map, std::vector, std::string, bool, std::int64_t, std::uint64_t, T>;
+
     template<class T>
     void load(const std::string& filepath, thames::settings::Parameters<T>& parameters) {
         /// @todo Input checking
@@ -41,14 +51,16 @@ namespace thames::io::json {
         // Open file stream
         std::ifstream filestream(filepath);
 
-        // Load JSON
-        nlohmann::json j;
+        // Load JSON, parsing numbers in the numeric type
+        basic_json<T> j;
         filestream >> j;
 
         // Load parameters
-        parameters = j.get<thames::settings::Parameters<T>>();
+        parameters = j.template get<thames::settings::Parameters<T>>();
     }
     template void load(const std::string&, thames::settings::Parameters<double>&);
+    template void load(const std::string&, thames::settings::Parameters<float>&);
+    template void load(const std::string&, thames::settings::Parameters<long double>&);
 
     template<class T>
     void save(const std::string& filepath, thames::settings::Parameters<T> parameters) {
@@ -63,11 +75,119 @@ namespace thames::io::json {
         parameters.metadata.datetimeModified = buffer;
 
         // Construct JSON object
+        // NOTE: numbers are written in double precision, as the JSON serialiser does not support extended precision
         nlohmann::json j = parameters;
 
         // Output JSON object
         filestream << std::setw(4) << j;
     }
     template void save(const std::string&, thames::settings::Parameters<double>); 
+    template void save(const std::string&, thames::settings::Parameters<float>);
+    template void save(const std::string&, thames::settings::Parameters<long double>);
+
+    template<class T>
+    void load(const std::string& filepath, thames::propagators::flowmap::FlowMap<T>& map) {
+        // Open file stream
+        std::ifstream filestream(filepath);
+        if(!filestream)
+            throw std::runtime_error("Unable to open flow map file " + filepath);
+
+        // Load JSON
+        nlohmann::json j;
+        filestream >> j;
+
+        // Load flow map
+        map = j.get<thames::propagators::flowmap::FlowMap<T>>();
+    }
+    template void load(const std::string&, thames::propagators::flowmap::FlowMap<double>&);
+
+    template<class T>
+    void save(const std::string& filepath, const thames::propagators::flowmap::FlowMap<T>& map) {
+        // Open file stream
+        std::ofstream filestream(filepath);
+
+        // Construct JSON object
+        nlohmann::json j = map;
+
+        // Output JSON object, without indentation to limit the size of the coefficients
+        filestream << j;
+    }
+    template void save(const std::string&, const thames::propagators::flowmap::FlowMap<double>&);
+
+    void load(const std::string& filepath, thames::settings::SweepParameters& sweep) {
+        // Open file stream
+        std::ifstream filestream(filepath);
+
+        // Load JSON
+        nlohmann::json j;
+        filestream >> j;
+
+        // Load sweep parameters
+        sweep = j.get<thames::settings::SweepParameters>();
+
+        // Check that each swept parameter has at least one value
+        for(const auto& [path, values] : sweep.parameters)
+            if(values.empty())
+                throw std::runtime_error("No values provided for swept parameter " + path);
+    }
+
+    std::size_t sweep_size(const thames::settings::SweepParameters& sweep) {
+        // Multiply number of values of each swept parameter
+        std::size_t size = 1;
+        for(const auto& [path, values] : sweep.parameters)
+            size *= values.size();
+
+        // Return number of cases
+        return size;
+    }
+
+    nlohmann::json sweep_case(const thames::settings::SweepParameters& sweep, const std::size_t index) {
+        // Declare parameter values
+        nlohmann::json values = nlohmann::json::object();
+
+        // Decompose index, with the last swept parameter varying fastest
+        std::size_t remainder = index;
+        for(auto it = sweep.parameters.rbegin(); it != sweep.parameters.rend(); it++){
+            values[it->first] = it->second[remainder % it->second.size()];
+            remainder /= it->second.size();
+        }
+
+        // Return parameter values
+        return values;
+    }
+
+    template<class T>
+    void apply_values(thames::settings::Parameters<T>& parameters, const nlohmann::json& values) {
+        // Detach states to avoid serialising them
+        std::vector<thames::settings::StateParameters<T>> states = std::move(parameters.states);
+        parameters.states.clear();
+
+        // Construct JSON object
+        basic_json<T> j = parameters;
+
+        // Apply each value
+        for(const auto& [path, value] : values.items()){
+            // Convert dotted path to JSON pointer
+            std::string pointer = "/" + path;
+            for(char& c : pointer)
+                if(c == '.')
+                    c = '/';
+
+            // Check that the parameter exists and is not a state
+            typename basic_json<T>::json_pointer jpointer(pointer);
+            if(path.rfind("states", 0) == 0 || !j.contains(jpointer))
+                throw std::runtime_error("Unsupported swept parameter " + path);
+
+            // Set value
+            j[jpointer] = value;
+        }
+
+        // Load parameters and reattach states
+        parameters = j.template get<thames::settings::Parameters<T>>();
+        parameters.states = std::move(states);
+    }
+    template void apply_values(thames::settings::Parameters<double>&, const nlohmann::json&);
+    template void apply_values(thames::settings::Parameters<float>&, const nlohmann::json&);
+    template void apply_values(thames::settings::Parameters<long double>&, const nlohmann::json&);
 
 }
\ No newline at end of file
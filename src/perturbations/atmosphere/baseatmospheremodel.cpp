@@ -53,7 +53,15 @@ namespace thames::perturbations::atmosphere::models {
         return 0.0;
     }
 
+    template<class T>
+    T BaseAtmosphereModel<T>::density_gradient(T alt) const {
+        // Return zero density gradient
+        return 0.0;
+    }
+
     template class BaseAtmosphereModel<double>;
+    template class BaseAtmosphereModel<float>;
+    template class BaseAtmosphereModel<long double>;
 
     /////////////////
     // Polynomials //
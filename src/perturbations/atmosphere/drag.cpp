@@ -45,7 +45,7 @@ namespace thames::perturbations::atmosphere::drag {
     using namespace thames::vector::arithmeticoverloads;
 
     template<class T>
-    Drag<T>::Drag(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModel<T>> model, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbation<T>(factors), m_radius(radius), m_w(w), m_Cd(Cd), m_A(A), m_m(m), m_model(model) {
+    Drag<T>::Drag(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModel<T>> model, const T& length) : BasePerturbation<T>(), m_radius(radius), m_w(w), m_Cd(Cd), m_A(A), m_m(m), m_model(model), m_length(length), m_dragFactor(-0.5*Cd*A/m*1e9) {
 
     }
 
@@ -54,6 +54,13 @@ namespace thames::perturbations::atmosphere::drag {
 
     }
 
+    template<class T>
+    std::shared_ptr<BasePerturbation<T>> Drag<T>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        // Return copy with pre-scaled constants
+        const T length = m_length*factors.length;
+        return std::make_shared<Drag<T>>(m_radius/factors.length, m_w*factors.time, m_Cd, m_A/std::pow(factors.length, 2), m_m/std::pow(factors.length, 3), m_model, length);
+    }
+
     template<class T>
     std::vector<T> Drag<T>::acceleration_total(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
         return acceleration_nonpotential(t, R, V);
@@ -61,46 +68,80 @@ namespace thames::perturbations::atmosphere::drag {
 
     template<class T>
     std::vector<T> Drag<T>::acceleration_nonpotential(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
-        // Calculate factors
-        T radius = (m_isNonDimensional) ? m_radius/(m_factors->length) : m_radius;
-        T w = (m_isNonDimensional) ? m_w*(m_factors->time) : m_w;
-        T Cd = m_Cd;
-        T A = (m_isNonDimensional) ? m_A/std::pow(m_factors->length, 2) : m_A;
-
-        // Calculate altitude
+        // Calculate altitude (in km)
         T r = thames::vector::geometry::norm3(R);
-        T alt = r - radius;
-
-        // Calculate atmospheric density (including conversion to kg/km^3)
-        if (m_isNonDimensional)
-            alt *= m_factors->length;
-        T rho = m_model->density(alt) * 1e9;
-        
-        // Calculate factors which include mass (cancelled via rho/mass) and non-dimensionalise as required
-        T massfac = rho/m_m;
-        if (m_isNonDimensional)
-            massfac *= std::pow(m_factors->length, 3);
+        T alt = (r - m_radius)*m_length;
+
+        // Calculate atmospheric density
+        T rho = m_model->density(alt);
 
         // Calculate velocity relative to the atmosphere
-        std::vector<T> W = {0, 0, w};
+        std::vector<T> W = {0, 0, m_w};
         std::vector<T> Vrel = V - thames::vector::geometry::cross3(W, R);
         T vrel = thames::vector::geometry::norm3(Vrel);
 
         // Calculate acceleration due to drag
-        std::vector<T> Ad = -0.5*Cd*A*massfac*vrel*Vrel;
+        std::vector<T> Ad = m_dragFactor*rho*vrel*Vrel;
 
         // Return acceleration
         return Ad;
     }
 
+    template<class T>
+    std::vector<T> Drag<T>::jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
+        // Calculate altitude (in km)
+        T r = thames::vector::geometry::norm3(R);
+        T alt = (r - m_radius)*m_length;
+
+        // Calculate atmospheric density, and its gradient with respect to the position
+        T rho = m_model->density(alt);
+        T drho = m_model->density_gradient(alt)*m_length/r;
+
+        // Calculate velocity relative to the atmosphere
+        std::vector<T> W = {0, 0, m_w};
+        std::vector<T> Vrel = V - thames::vector::geometry::cross3(W, R);
+        T vrel = thames::vector::geometry::norm3(Vrel);
+
+        // Calculate partial derivatives of the acceleration with respect to the relative velocity
+        std::array<std::array<T, 3>, 3> dAdVrel;
+        for (std::size_t ii = 0; ii < 3; ii++) {
+            for (std::size_t jj = 0; jj < 3; jj++)
+                dAdVrel[ii][jj] = m_dragFactor*rho*Vrel[ii]*Vrel[jj]/vrel;
+            dAdVrel[ii][ii] += m_dragFactor*rho*vrel;
+        }
+
+        // Declare Jacobian
+        std::vector<T> J(18);
+
+        // Calculate partial derivatives with respect to position (through density and rotation of the atmosphere) and velocity
+        // NOTE: the relative velocity depends on position through -W x R = (m_w*y, -m_w*x, 0)
+        for (std::size_t ii = 0; ii < 3; ii++) {
+            J[6*ii + 0] = m_dragFactor*drho*vrel*Vrel[ii]*R[0] - m_w*dAdVrel[ii][1];
+            J[6*ii + 1] = m_dragFactor*drho*vrel*Vrel[ii]*R[1] + m_w*dAdVrel[ii][0];
+            J[6*ii + 2] = m_dragFactor*drho*vrel*Vrel[ii]*R[2];
+            for (std::size_t jj = 0; jj < 3; jj++)
+                J[6*ii + 3 + jj] = dAdVrel[ii][jj];
+        }
+
+        // Return Jacobian
+        return J;
+    }
+
+    template<class T>
+    std::string Drag<T>::name() const {
+        return "Drag";
+    }
+
     template class Drag<double>;
+    template class Drag<float>;
+    template class Drag<long double>;
 
     #ifdef THAMES_USE_SMARTUQ
 
     using namespace smartuq::polynomial;
 
     template<class T, template <class> class P>
-    DragPolynomial<T, P>::DragPolynomial(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModelPolynomial<T, P>> model, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbationPolynomial<T, P>(factors), m_radius(radius), m_w(w), m_Cd(Cd), m_A(A), m_m(m), m_model(model) {
+    DragPolynomial<T, P>::DragPolynomial(const T& radius, const T& w, const T& Cd, const T& A, const T& m, const std::shared_ptr<const BaseAtmosphereModelPolynomial<T, P>> model, const T& length) : BasePerturbationPolynomial<T, P>(), m_radius(radius), m_w(w), m_Cd(Cd), m_A(A), m_m(m), m_model(model), m_length(length), m_dragFactor(-0.5*Cd*A/m*1e9) {
 
     }
 
@@ -109,6 +150,13 @@ namespace thames::perturbations::atmosphere::drag {
 
     }
 
+    template<class T, template <class> class P>
+    std::shared_ptr<BasePerturbationPolynomial<T, P>> DragPolynomial<T, P>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        // Return copy with pre-scaled constants
+        const T length = m_length*factors.length;
+        return std::make_shared<DragPolynomial<T, P>>(m_radius/factors.length, m_w*factors.time, m_Cd, m_A/std::pow(factors.length, 2), m_m/std::pow(factors.length, 3), m_model, length);
+    }
+
     template<class T, template <class> class P>
     std::vector<P<T>> DragPolynomial<T, P>::acceleration_total(const T& t, const std::vector<P<T>>& R, const std::vector<P<T>>& V) const {
         return acceleration_nonpotential(t, R, V);
@@ -116,36 +164,23 @@ namespace thames::perturbations::atmosphere::drag {
 
     template<class T, template <class> class P>
     std::vector<P<T>> DragPolynomial<T, P>::acceleration_nonpotential(const T& t, const std::vector<P<T>>& R, const std::vector<P<T>>& V) const {
-        // Calculate factors
-        T radius = (m_isNonDimensional) ? m_radius/(m_factors->length) : m_radius;
-        T w = (m_isNonDimensional) ? m_w*(m_factors->time) : m_w;
-        T Cd = m_Cd;
-        T A = (m_isNonDimensional) ? m_A/std::pow(m_factors->length, 2) : m_A;
-
-        // Calculate altitude
+        // Calculate altitude (in km)
         P<T> r = thames::vector::geometry::norm3(R);
-        P<T> alt = r - radius;
-
-        // Calculate atmospheric density (including conversion to kg/km^3)
-        if (m_isNonDimensional)
-            alt *= m_factors->length;
-        P<T> rho = m_model->density(alt) * 1e9;
-        
-        // Calculate factors which include mass (cancelled via rho/mass) and non-dimensionalise as required
-        P<T> massfac = rho/m_m;
-        if (m_isNonDimensional)
-            massfac *= std::pow(m_factors->length, 3);
+        P<T> alt = (r - m_radius)*m_length;
+
+        // Calculate atmospheric density
+        P<T> rho = m_model->density(alt);
 
         // Calculate velocity relative to the atmosphere
         int nvar = R[0].get_nvar();
         int degree = R[0].get_degree();
         P<T> poly(nvar, degree);
-        std::vector<P<T>> W = {poly, poly, w*(poly+1)};
+        std::vector<P<T>> W = {poly, poly, m_w*(poly+1)};
         std::vector<P<T>> Vrel = V - thames::vector::geometry::cross3(W, R);
         P<T> vrel = thames::vector::geometry::norm3(Vrel);
 
         // Calculate acceleration due to drag
-        std::vector<P<T>> Ad = -0.5*Cd*A*massfac*vrel*Vrel;
+        std::vector<P<T>> Ad = m_dragFactor*rho*vrel*Vrel;
 
         // Return acceleration
         return Ad;
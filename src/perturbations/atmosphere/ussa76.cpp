@@ -48,9 +48,9 @@ namespace thames::perturbations::atmosphere::models {
     }
 
     template<class T>
-    T USSA76AtmosphereModel<T>::density(T alt) const {
+    std::size_t USSA76AtmosphereModel<T>::interval(const T alt) const {
         // Declare index variable
-        std::size_t ii;
+        std::size_t ii = 0;
 
         // Handle altitudes outside of the range
         T altselect = alt;
@@ -68,6 +68,15 @@ namespace thames::perturbations::atmosphere::models {
         if (altselect >= m_geo.back())
             ii = m_geo.size() - 1;
 
+        // Return index
+        return ii;
+    }
+
+    template<class T>
+    T USSA76AtmosphereModel<T>::density(T alt) const {
+        // Determine interpolation interval
+        const std::size_t ii = interval(alt);
+
         // Exponential interpolation
         T rho = m_rho[ii]*std::exp(-(alt - m_geo[ii])/m_scale[ii]);
 
@@ -75,7 +84,21 @@ namespace thames::perturbations::atmosphere::models {
         return rho;
     }
 
+    template<class T>
+    T USSA76AtmosphereModel<T>::density_gradient(T alt) const {
+        // Determine interpolation interval
+        const std::size_t ii = interval(alt);
+
+        // Differentiate exponential interpolation
+        T drho = -m_rho[ii]*std::exp(-(alt - m_geo[ii])/m_scale[ii])/m_scale[ii];
+
+        // Return density gradient
+        return drho;
+    }
+
     template class USSA76AtmosphereModel<double>;
+    template class USSA76AtmosphereModel<float>;
+    template class USSA76AtmosphereModel<long double>;
 
     /////////////////
     // Polynomials //
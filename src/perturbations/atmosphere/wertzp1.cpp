@@ -63,7 +63,28 @@ namespace thames::perturbations::atmosphere::models {
         return rho;
     }
 
+    template<class T>
+    T WertzP1AtmosphereModel<T>::density_gradient(T alt) const {
+        // Scale altitude
+        const T altscaled = 2.0*(alt - m_domain[0])/(m_domain[1] - m_domain[0]) - 1.0;
+
+        // Evaluate polynomial and its derivative with respect to the scaled altitude
+        T logrho = 0.0, dlogrho = 0.0;
+        for (std::size_t ii=m_coeff.size(); ii-- > 0;) {
+            dlogrho = dlogrho*altscaled + logrho;
+            logrho = logrho*altscaled + m_coeff[ii];
+        }
+
+        // Apply chain rule through the exponential and the altitude scaling
+        T drho = exp(logrho)*dlogrho*2.0/(m_domain[1] - m_domain[0]);
+
+        // Return density gradient
+        return drho;
+    }
+
     template class WertzP1AtmosphereModel<double>;
+    template class WertzP1AtmosphereModel<float>;
+    template class WertzP1AtmosphereModel<long double>;
 
     /////////////////
     // Polynomials //
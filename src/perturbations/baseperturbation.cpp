@@ -22,7 +22,10 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -41,7 +44,7 @@ namespace thames::perturbations::baseperturbation{
     ///////////
 
     template<class T>
-    BasePerturbation<T>::BasePerturbation(const std::shared_ptr<const DimensionalFactors<T>> factors) : m_factors(factors) {
+    BasePerturbation<T>::BasePerturbation() {
 
     };
 
@@ -51,13 +54,8 @@ namespace thames::perturbations::baseperturbation{
     };
 
     template<class T>
-    bool BasePerturbation<T>::get_nondimensional() {
-        return m_isNonDimensional;
-    }
-
-    template<class T>
-    void BasePerturbation<T>::set_nondimensional(bool isNonDimensional) {
-        m_isNonDimensional = isNonDimensional;
+    std::shared_ptr<BasePerturbation<T>> BasePerturbation<T>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        return std::make_shared<BasePerturbation<T>>(*this);
     }
 
     template<class T>
@@ -66,25 +64,138 @@ namespace thames::perturbations::baseperturbation{
         return F;
     };
 
+    template<class T>
+    void BasePerturbation<T>::acceleration_total_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const {
+        // Declare member state vectors
+        std::vector<T> R(3), V(3);
+
+        // Iterate through ensemble members
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Gather member state
+            for (std::size_t jj = 0; jj < 3; jj++) {
+                R[jj] = RV[jj*n + ii];
+                V[jj] = RV[(jj + 3)*n + ii];
+            }
+
+            // Calculate and add member acceleration
+            const std::vector<T> F = acceleration_total(t, R, V);
+            for (std::size_t jj = 0; jj < 3; jj++)
+                A[jj*n + ii] += F[jj];
+        }
+    }
+
     template<class T>
     std::vector<T> BasePerturbation<T>::acceleration_nonpotential(const T& t, const std::vector<T>& R, const std::vector<T>& V) const{
         std::vector<T> F = {0.0, 0.0, 0.0};
         return F;
     };
 
+    template<class T>
+    void BasePerturbation<T>::acceleration_nonpotential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const {
+        // Declare member state vectors
+        std::vector<T> R(3), V(3);
+
+        // Iterate through ensemble members
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Gather member state
+            for (std::size_t jj = 0; jj < 3; jj++) {
+                R[jj] = RV[jj*n + ii];
+                V[jj] = RV[(jj + 3)*n + ii];
+            }
+
+            // Calculate and add member acceleration
+            const std::vector<T> F = acceleration_nonpotential(t, R, V);
+            for (std::size_t jj = 0; jj < 3; jj++)
+                A[jj*n + ii] += F[jj];
+        }
+    }
+
     template<class T>
     T BasePerturbation<T>::potential(const T& t, const std::vector<T>& R) const{
         T U = 0.0;
         return U;
     }
 
+    template<class T>
+    void BasePerturbation<T>::potential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& U, const std::size_t n) const {
+        // Declare member position vector
+        std::vector<T> R(3);
+
+        // Iterate through ensemble members
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Gather member position
+            for (std::size_t jj = 0; jj < 3; jj++)
+                R[jj] = RV[jj*n + ii];
+
+            // Calculate and add member potential
+            U[ii] += potential(t, R);
+        }
+    }
+
     template<class T>
     T BasePerturbation<T>::potential_derivative(const T& t, const std::vector<T>& R, const std::vector<T>& V) const{
         T Ut = 0.0;
         return Ut;
     }
 
+    template<class T>
+    void BasePerturbation<T>::potential_derivative_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& Ut, const std::size_t n) const {
+        // Declare member state vectors
+        std::vector<T> R(3), V(3);
+
+        // Iterate through ensemble members
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Gather member state
+            for (std::size_t jj = 0; jj < 3; jj++) {
+                R[jj] = RV[jj*n + ii];
+                V[jj] = RV[(jj + 3)*n + ii];
+            }
+
+            // Calculate and add member potential derivative
+            Ut[ii] += potential_derivative(t, R, V);
+        }
+    }
+
+    template<class T>
+    std::vector<T> BasePerturbation<T>::jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
+        // Declare Jacobian
+        std::vector<T> J(18, 0.0);
+
+        // Iterate through position and velocity components
+        for (std::size_t jj = 0; jj < 6; jj++) {
+            // Calculate step, scaled with the magnitude of the component
+            const T x = (jj < 3) ? R[jj] : V[jj-3];
+            const T h = std::cbrt(std::numeric_limits<T>::epsilon())*std::max<T>(std::abs(x), 1.0);
+
+            // Perturb component
+            std::vector<T> Rp(R), Rm(R), Vp(V), Vm(V);
+            if (jj < 3) {
+                Rp[jj] += h;
+                Rm[jj] -= h;
+            } else {
+                Vp[jj-3] += h;
+                Vm[jj-3] -= h;
+            }
+
+            // Calculate central difference of the acceleration
+            const std::vector<T> Fp = acceleration_total(t, Rp, Vp);
+            const std::vector<T> Fm = acceleration_total(t, Rm, Vm);
+            for (std::size_t ii = 0; ii < 3; ii++)
+                J[6*ii + jj] = (Fp[ii] - Fm[ii])/(2.0*h);
+        }
+
+        // Return Jacobian
+        return J;
+    }
+
+    template<class T>
+    std::string BasePerturbation<T>::name() const {
+        return "Perturbation";
+    }
+
     template class BasePerturbation<double>;
+    template class BasePerturbation<float>;
+    template class BasePerturbation<long double>;
 
     /////////////////
     // Polynomials //
@@ -96,7 +207,7 @@ namespace thames::perturbations::baseperturbation{
     using thames::conversions::dimensional::DimensionalFactors;
     
     template<class T, template<class> class P>
-    BasePerturbationPolynomial<T, P>::BasePerturbationPolynomial(const std::shared_ptr<const DimensionalFactors<T>> factors) : m_factors(factors) {
+    BasePerturbationPolynomial<T, P>::BasePerturbationPolynomial() {
 
     };
 
@@ -106,13 +217,8 @@ namespace thames::perturbations::baseperturbation{
     };
 
     template<class T, template<class> class P>
-    bool BasePerturbationPolynomial<T, P>::get_nondimensional() {
-        return m_isNonDimensional;
-    }
-
-    template<class T, template<class> class P>
-    void BasePerturbationPolynomial<T, P>::set_nondimensional(const bool isNonDimensional) {
-        m_isNonDimensional = isNonDimensional;
+    std::shared_ptr<BasePerturbationPolynomial<T, P>> BasePerturbationPolynomial<T, P>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        return std::make_shared<BasePerturbationPolynomial<T, P>>(*this);
     }
 
     template<class T, template<class> class P>
@@ -25,6 +25,7 @@ SOFTWARE.
 #include <array>
 #include <cmath>
 #include <memory>
+#include <string>
 #include <vector>
 
 #ifdef THAMES_USE_SMARTUQ
@@ -33,18 +34,20 @@ SOFTWARE.
 
 #include "../../../include/conversions/dimensional.h"
 #include "../../../include/perturbations/geopotential/J2.h"
+#include "../../../include/util/powers.h"
 #include "../../../include/vector/geometry.h"
 
 namespace thames::perturbations::geopotential {
 
     using thames::conversions::dimensional::DimensionalFactors;
+    using thames::util::powers::ipow;
 
     ///////////
     // Reals //
     ///////////
 
     template <class T>
-    J2<T>::J2(const T& mu, const T& J2, const T& radius, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbation<T>(factors), m_mu(mu), m_J2(J2), m_radius(radius) {
+    J2<T>::J2(const T& mu, const T& J2, const T& radius) : BasePerturbation<T>(), m_mu(mu), m_J2(J2), m_radius(radius), m_accelerationFactor(-1.5*mu*J2*radius*radius), m_potentialFactor(0.5*mu*J2*radius*radius) {
 
     }
 
@@ -54,12 +57,13 @@ namespace thames::perturbations::geopotential {
     }
 
     template <class T>
-    std::vector<T> J2<T>::acceleration_total(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
-        const T J2 = m_J2;
-        const T radius = (m_isNonDimensional) ? m_radius/m_factors->length : m_radius;
+    std::shared_ptr<BasePerturbation<T>> J2<T>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        // Return copy with pre-scaled constants
+        return std::make_shared<J2<T>>(m_mu/factors.grav, m_J2, m_radius/factors.length);
+    }
 
+    template <class T>
+    std::vector<T> J2<T>::acceleration_total(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
         // Extract position components
         const T x = R[0], y = R[1], z = R[2];
 
@@ -67,14 +71,14 @@ namespace thames::perturbations::geopotential {
         const T r = thames::vector::geometry::norm3(R);
 
         // Precompute factors
-        const T J2_fac1 = -1.5*mu*J2*pow(radius, 2.0)/pow(r, 5.0);
-        const T J2_fac2 = 5.0*pow(z, 2.0)/pow(r, 2.0);
+        const T J2_fac1 = m_accelerationFactor/ipow<5>(r);
+        const T J2_fac2 = 5.0*ipow<2>(z)/ipow<2>(r);
 
         // Declare and calculate perturbing acceleration vector
         const std::vector<T> A = {
-            J2_fac1*x*(1.0 - J2_fac2),
-            J2_fac1*y*(1.0 - J2_fac2),
-            J2_fac1*z*(3.0 - J2_fac2)
+            T(J2_fac1*x*(1.0 - J2_fac2)),
+            T(J2_fac1*y*(1.0 - J2_fac2)),
+            T(J2_fac1*z*(3.0 - J2_fac2))
         };
 
         // Return perturbing acceleration vector
@@ -82,12 +86,31 @@ namespace thames::perturbations::geopotential {
     }
 
     template <class T>
-    T J2<T>::potential(const T& t, const std::vector<T>& R) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
-        const T J2 = m_J2;
-        const T radius = (m_isNonDimensional) ? m_radius/m_factors->length : m_radius;
+    void J2<T>::acceleration_total_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const {
+        // Extract position components
+        const T* x = RV.data();
+        const T* y = x + n;
+        const T* z = y + n;
+
+        // Extract acceleration components
+        T* ax = A.data();
+        T* ay = ax + n;
+        T* az = ay + n;
+
+        // Calculate perturbing accelerations
+        for (std::size_t ii = 0; ii < n; ii++) {
+            const T r2 = x[ii]*x[ii] + y[ii]*y[ii] + z[ii]*z[ii];
+            const T r = std::sqrt(r2);
+            const T J2_fac1 = m_accelerationFactor/(r2*r2*r);
+            const T J2_fac2 = 5.0*z[ii]*z[ii]/r2;
+            ax[ii] += J2_fac1*x[ii]*(1.0 - J2_fac2);
+            ay[ii] += J2_fac1*y[ii]*(1.0 - J2_fac2);
+            az[ii] += J2_fac1*z[ii]*(3.0 - J2_fac2);
+        }
+    }
 
+    template <class T>
+    T J2<T>::potential(const T& t, const std::vector<T>& R) const {
         // Extract position components
         const T z = R[2];
 
@@ -98,13 +121,72 @@ namespace thames::perturbations::geopotential {
         const T cphi = z/r;
 
         // Calculate perturbing potential
-        const T U = 0.5*J2*mu/pow(r, 3.0)*pow(radius, 2.0)*(3.0*pow(cphi, 2.0) - 1.0);
+        const T U = m_potentialFactor/ipow<3>(r)*(3.0*ipow<2>(cphi) - 1.0);
 
         // Return perturbing potential
         return U;
     }
 
+    template <class T>
+    void J2<T>::potential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& U, const std::size_t n) const {
+        // Extract position components
+        const T* x = RV.data();
+        const T* y = x + n;
+        const T* z = y + n;
+
+        // Calculate perturbing potentials
+        for (std::size_t ii = 0; ii < n; ii++) {
+            const T r2 = x[ii]*x[ii] + y[ii]*y[ii] + z[ii]*z[ii];
+            const T r = std::sqrt(r2);
+            U[ii] += m_potentialFactor/(r2*r)*(3.0*z[ii]*z[ii]/r2 - 1.0);
+        }
+    }
+
+    template <class T>
+    std::vector<T> J2<T>::jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
+        // Extract position components
+        const T z = R[2];
+
+        // Calculate range
+        const T r2 = R[0]*R[0] + R[1]*R[1] + z*z;
+        const T r = std::sqrt(r2);
+
+        // Precompute factors
+        const T J2_fac1 = m_accelerationFactor/(r2*r2*r);
+        const T J2_fac2 = 5.0*z*z/r2;
+        const std::array<T, 3> c = {T(1.0 - J2_fac2), T(1.0 - J2_fac2), T(3.0 - J2_fac2)};
+
+        // Declare Jacobian (independent of velocity)
+        std::vector<T> J(18, 0.0);
+
+        // Calculate partial derivatives with respect to position
+        for (std::size_t jj = 0; jj < 3; jj++) {
+            // Calculate partial derivative of the latitude factor
+            T dfac2 = -2.0*J2_fac2*R[jj]/r2;
+            if (jj == 2)
+                dfac2 += 10.0*z/r2;
+
+            // Differentiate each acceleration component
+            for (std::size_t ii = 0; ii < 3; ii++) {
+                T dA = -R[ii]*dfac2 - 5.0*R[ii]*c[ii]*R[jj]/r2;
+                if (ii == jj)
+                    dA += c[ii];
+                J[6*ii + jj] = J2_fac1*dA;
+            }
+        }
+
+        // Return Jacobian
+        return J;
+    }
+
+    template<class T>
+    std::string J2<T>::name() const {
+        return "J2";
+    }
+
     template class J2<double>;
+    template class J2<float>;
+    template class J2<long double>;
 
     /////////////////
     // Polynomials //
@@ -116,7 +198,7 @@ namespace thames::perturbations::geopotential {
     using thames::conversions::dimensional::DimensionalFactors;
 
     template<class T, template<class> class P>
-    J2Polynomial<T, P>::J2Polynomial(const T& mu, const T& J2, const T& radius, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbationPolynomial<T, P>(factors), m_mu(mu), m_J2(J2), m_radius(radius) {
+    J2Polynomial<T, P>::J2Polynomial(const T& mu, const T& J2, const T& radius) : BasePerturbationPolynomial<T, P>(), m_mu(mu), m_J2(J2), m_radius(radius), m_accelerationFactor(-1.5*mu*J2*radius*radius), m_potentialFactor(0.5*mu*J2*radius*radius) {
 
     }
 
@@ -126,12 +208,13 @@ namespace thames::perturbations::geopotential {
     }
 
     template<class T, template<class> class P>
-    std::vector<P<T>> J2Polynomial<T, P>::acceleration_total(const T& t, const std::vector<P<T>>& R, const std::vector<P<T>>& V) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
-        const T J2 = m_J2;
-        const T radius = (m_isNonDimensional) ? m_radius/m_factors->length : m_radius;
+    std::shared_ptr<BasePerturbationPolynomial<T, P>> J2Polynomial<T, P>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        // Return copy with pre-scaled constants
+        return std::make_shared<J2Polynomial<T, P>>(m_mu/factors.grav, m_J2, m_radius/factors.length);
+    }
 
+    template<class T, template<class> class P>
+    std::vector<P<T>> J2Polynomial<T, P>::acceleration_total(const T& t, const std::vector<P<T>>& R, const std::vector<P<T>>& V) const {
         // Extract position components
         const P<T> x = R[0], y = R[1], z = R[2];
 
@@ -139,8 +222,8 @@ namespace thames::perturbations::geopotential {
         const P<T> r = thames::vector::geometry::norm3(R);
 
         // Precompute factors
-        const P<T> J2_fac1 = -1.5*mu*J2*pow(radius, 2)/pow(r, 5);
-        const P<T> J2_fac2 = 5.0*pow(z, 2)/pow(r, 2);
+        const P<T> J2_fac1 = m_accelerationFactor/ipow<5>(r);
+        const P<T> J2_fac2 = 5.0*ipow<2>(z)/ipow<2>(r);
 
         // Declare and calculate perturbing acceleration vector
         const std::vector<P<T>> A = {
@@ -155,11 +238,6 @@ namespace thames::perturbations::geopotential {
 
     template<class T, template<class> class P>
     P<T> J2Polynomial<T, P>::potential(const T& t, const std::vector<P<T>>& R) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
-        const T J2 = m_J2;
-        const T radius = (m_isNonDimensional) ? m_radius/m_factors->length : m_radius;
-
         // Extract position components
         const P<T> z = R[2];
 
@@ -170,7 +248,7 @@ namespace thames::perturbations::geopotential {
         const P<T> cphi = z/r;
 
         // Calculate perturbing potential
-        const P<T> U = 0.5*J2*mu/pow(r, 3)*pow(radius, 2)*(3.0*pow(cphi, 2) - 1.0);
+        const P<T> U = m_potentialFactor/ipow<3>(r)*(3.0*ipow<2>(cphi) - 1.0);
 
         // Return perturbing potential
         return U;
@@ -28,12 +28,14 @@ SOFTWARE.
 
 #include "../../include/perturbations/baseperturbation.h"
 #include "../../include/perturbations/perturbationcombiner.h"
+#include "../../include/util/profiling.h"
 #include "../../include/vector/arithmeticoverloads.h"
 
 namespace thames::perturbations::perturbationcombiner {
 
     using thames::conversions::dimensional::DimensionalFactors;
     using thames::perturbations::baseperturbation::BasePerturbation;
+    using thames::util::profiling::Clock;
 
     using namespace thames::vector::arithmeticoverloads;
 
@@ -42,15 +44,13 @@ namespace thames::perturbations::perturbationcombiner {
     ///////////
 
     template<class T>
-    PerturbationCombiner<T>::PerturbationCombiner(const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbation<T>(factors) {
-        // Ensure all underlying models have same non-dimensional flag
-        set_nondimensional(m_isNonDimensional);
+    PerturbationCombiner<T>::PerturbationCombiner() : BasePerturbation<T>() {
+
     }
 
     template<class T>
-    PerturbationCombiner<T>::PerturbationCombiner(const std::vector<std::shared_ptr<BasePerturbation<T>>>& models, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbation<T>(factors), m_models(models) {
-        // Ensure all underlying models have same non-dimensional flag
-        set_nondimensional(m_isNonDimensional);
+    PerturbationCombiner<T>::PerturbationCombiner(const std::vector<std::shared_ptr<BasePerturbation<T>>>& models) : BasePerturbation<T>(), m_models(models) {
+
     }
 
     template<class T>
@@ -59,17 +59,21 @@ namespace thames::perturbations::perturbationcombiner {
     }
 
     template<class T>
-    void PerturbationCombiner<T>::set_nondimensional(const bool isNonDimensional) {
-        // Iterate through underlying models to set non-dimensional flag
+    std::shared_ptr<BasePerturbation<T>> PerturbationCombiner<T>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        // Declare non-dimensional models
+        std::vector<std::shared_ptr<BasePerturbation<T>>> models;
+        models.reserve(m_models.size());
+
+        // Iterate through underlying models to create non-dimensional copies
         for (auto model : m_models)
-            model->set_nondimensional(isNonDimensional);
+            models.push_back(model->nondimensionalise(factors));
+
+        // Return non-dimensional combiner
+        return std::make_shared<PerturbationCombiner<T>>(models);
     }
 
     template<class T>
     void PerturbationCombiner<T>::add_model(const std::shared_ptr<BasePerturbation<T>>& model) {
-        // Ensure model has same non-dimensional flag
-        model->set_nondimensional(m_isNonDimensional);
-
         // Add model to class vector
         m_models.push_back(model);
     }
@@ -79,54 +83,142 @@ namespace thames::perturbations::perturbationcombiner {
         /// Declare zero total acceleration
         std::vector<T> F = {0.0, 0.0, 0.0};
 
-        // Iterate through underlying models to add to the total acceleration
-        for (auto model : m_models)
+        // Iterate through underlying models to add to the total acceleration, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
             F = F + model->acceleration_total(t, R, V);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
 
         // Return acceleration
         return F;
     }
 
+    template<class T>
+    void PerturbationCombiner<T>::acceleration_total_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const {
+        // Iterate through underlying models to add to the total accelerations, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
+            model->acceleration_total_ensemble(t, RV, A, n);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
+    }
+
     template<class T>
     std::vector<T> PerturbationCombiner<T>::acceleration_nonpotential(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
         /// Declare zero non-potential acceleration
         std::vector<T> F = {0.0, 0.0, 0.0};
 
-        // Iterate through underlying models to add to the non-potential acceleration
-        for (auto model : m_models)
+        // Iterate through underlying models to add to the non-potential acceleration, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
             F = F + model->acceleration_nonpotential(t, R, V);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
 
         // Return acceleration
         return F;
     }
 
+    template<class T>
+    void PerturbationCombiner<T>::acceleration_nonpotential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& A, const std::size_t n) const {
+        // Iterate through underlying models to add to the total non-potential accelerations, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
+            model->acceleration_nonpotential_ensemble(t, RV, A, n);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
+    }
+
     template<class T>
     T PerturbationCombiner<T>::potential(const T& t, const std::vector<T>& R) const {
         /// Declare zero potential
         T U = 0.0;
 
-        // Iterate through underlying models to add to the potential
-        for (auto model : m_models)
+        // Iterate through underlying models to add to the potential, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
             U += model->potential(t, R);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
 
         // Return potential
         return U;
     }
 
+    template<class T>
+    void PerturbationCombiner<T>::potential_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& U, const std::size_t n) const {
+        // Iterate through underlying models to add to the total potentials, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
+            model->potential_ensemble(t, RV, U, n);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
+    }
+
     template<class T>
     T PerturbationCombiner<T>::potential_derivative(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
         /// Declare zero potential derivative
         T Ut = 0.0;
 
-        // Iterate through underlying models to add to the potential derivative
-        for (auto model : m_models)
+        // Iterate through underlying models to add to the potential derivative, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
             Ut += model->potential_derivative(t, R, V);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
 
         // Return potential derivative
         return Ut;
     }
 
+    template<class T>
+    void PerturbationCombiner<T>::potential_derivative_ensemble(const T& t, const std::vector<T>& RV, std::vector<T>& Ut, const std::size_t n) const {
+        // Iterate through underlying models to add to the total potential derivatives, timing each model if sampled
+        const bool sampled = thames::util::profiling::sample_perturbation();
+        for (auto model : m_models) {
+            const Clock::time_point start = sampled ? Clock::now() : Clock::time_point();
+            model->potential_derivative_ensemble(t, RV, Ut, n);
+            if (sampled)
+                thames::util::profiling::record("perturbation/" + model->name(), start, Clock::now());
+        }
+    }
+
+    template<class T>
+    std::vector<T> PerturbationCombiner<T>::jacobian(const T& t, const std::vector<T>& R, const std::vector<T>& V) const {
+        /// Declare zero Jacobian
+        std::vector<T> J(18, 0.0);
+
+        // Iterate through underlying models to add to the Jacobian
+        for (auto model : m_models)
+            J = J + model->jacobian(t, R, V);
+
+        // Return Jacobian
+        return J;
+    }
+
+    template<class T>
+    std::string PerturbationCombiner<T>::name() const {
+        return "PerturbationCombiner";
+    }
+
     template class PerturbationCombiner<double>;
+    template class PerturbationCombiner<float>;
+    template class PerturbationCombiner<long double>;
 
     /////////////////
     // Polynomials //
@@ -139,15 +231,13 @@ namespace thames::perturbations::perturbationcombiner {
     using thames::perturbations::baseperturbation::BasePerturbationPolynomial;
 
     template<class T, template <class> class P>
-    PerturbationCombinerPolynomial<T, P>::PerturbationCombinerPolynomial(const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbationPolynomial<T, P>(factors) {
-        // Ensure all underlying models have same non-dimensional flag
-        set_nondimensional(m_isNonDimensional);
+    PerturbationCombinerPolynomial<T, P>::PerturbationCombinerPolynomial() : BasePerturbationPolynomial<T, P>() {
+
     }
 
     template<class T, template <class> class P>
-    PerturbationCombinerPolynomial<T, P>::PerturbationCombinerPolynomial(const std::vector<std::shared_ptr<BasePerturbationPolynomial<T, P>>>& models, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePerturbationPolynomial<T, P>(factors), m_models(models) {
-        // Ensure all underlying models have same non-dimensional flag
-        set_nondimensional(m_isNonDimensional);
+    PerturbationCombinerPolynomial<T, P>::PerturbationCombinerPolynomial(const std::vector<std::shared_ptr<BasePerturbationPolynomial<T, P>>>& models) : BasePerturbationPolynomial<T, P>(), m_models(models) {
+
     }
 
     template<class T, template <class> class P>
@@ -156,17 +246,21 @@ namespace thames::perturbations::perturbationcombiner {
     }
 
     template<class T, template <class> class P>
-    void PerturbationCombinerPolynomial<T, P>::set_nondimensional(const bool isNonDimensional) {
-        // Iterate through underlying models to set non-dimensional flag
+    std::shared_ptr<BasePerturbationPolynomial<T, P>> PerturbationCombinerPolynomial<T, P>::nondimensionalise(const DimensionalFactors<T>& factors) const {
+        // Declare non-dimensional models
+        std::vector<std::shared_ptr<BasePerturbationPolynomial<T, P>>> models;
+        models.reserve(m_models.size());
+
+        // Iterate through underlying models to create non-dimensional copies
         for (auto model : m_models)
-            model->set_nondimensional(isNonDimensional);
+            models.push_back(model->nondimensionalise(factors));
+
+        // Return non-dimensional combiner
+        return std::make_shared<PerturbationCombinerPolynomial<T, P>>(models);
     }
 
     template<class T, template <class> class P>
     void PerturbationCombinerPolynomial<T, P>::add_model(const std::shared_ptr<BasePerturbationPolynomial<T, P>>& model) {
-        // Ensure model has same non-dimensional flag
-        model->set_nondimensional(m_isNonDimensional);
-
         // Add model to class vector
         m_models.push_back(model);
     }
@@ -22,8 +22,15 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include <boost/numeric/odeint.hpp>
@@ -39,21 +46,93 @@ SOFTWARE.
 #include "../../include/conversions/polynomial.h"
 #include "../../include/conversions/universal.h"
 #include "../../include/propagators/basepropagator.h"
+#include "../../include/propagators/flowmap.h"
+#include "../../include/propagators/mixedprecision.h"
 #include "../../include/settings/settings.h"
+#include "../../include/util/angles.h"
+#include "../../include/util/covariance.h"
 #include "../../include/util/polynomials.h"
+#include "../../include/util/profiling.h"
+#include "../../include/util/root.h"
+#include "../../include/util/threadpool.h"
 
 namespace thames::propagators::basepropagator {
 
     using thames::constants::statetypes::StateTypes;
     using thames::constants::statetypes::CARTESIAN;
+    using thames::constants::statetypes::GEQOE;
+    using thames::propagators::mixedprecision::MixedPrecisionAlgebra;
+    using thames::propagators::mixedprecision::MixedPrecisionState;
     using thames::settings::PropagatorParameters;
 
     ///////////
     // Reals //
     ///////////
 
+    /**
+     * @brief Calculate the number of whole fixed steps covering an interval.
+     * 
+     * The scaled times of non-dimensional propagation may exceed an exact multiple of the timestep by rounding error alone, which would otherwise add a spurious step.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @param[in] tstart Start time.
+     * @param[in] tend End time.
+     * @param[in] tstep Timestep.
+     * @return unsigned int Number of steps.
+     */
     template<class T>
-    BasePropagator<T>::BasePropagator(const T& mu, const std::shared_ptr<BasePerturbation<T>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors, const StateTypes propstatetype) : m_mu(mu), m_perturbation(perturbation), m_factors(factors), m_propstatetype(propstatetype) {
+    unsigned int step_count(const T tstart, const T tend, const T tstep) {
+        // Round up to whole steps, ignoring excess within a few ulps
+        const T ratio = (tend - tstart)/tstep;
+        return (unsigned int) ceil(ratio*(1 - 64*std::numeric_limits<T>::epsilon()));
+    }
+
+    /**
+     * @brief Integrate a state over an interval, with the stepper according to the fixed flag.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @tparam Algebra Algebra type of the state.
+     * @tparam State State type.
+     * @tparam F State derivative type.
+     * @param[in] func State derivative.
+     * @param[in,out] x State, in the units and coordinates of the propagation.
+     * @param[in] tstart Start time, in the units of the propagation.
+     * @param[in] tend End time, in the units of the propagation.
+     * @param[in] tstep Fixed or initial timestep, in the units of the propagation.
+     * @param[in] options Propagator options.
+     */
+    template<class T, class Algebra, class State, class F>
+    void integrate_interval(F func, State& x, const T tstart, const T tend, const T tstep, const PropagatorParameters<T>& options) {
+        // Time integration
+        thames::util::profiling::ScopedTimer timer("integrate");
+
+        // Propagate according to the fixed flag
+        if(options.isFixedStep){
+            // Declare stepper
+            boost::numeric::odeint::runge_kutta4<State, T, State, T, Algebra> stepper;
+
+            // Propagate with whole steps ending at the final time
+            // NOTE: integrate_const omits the final step if the scaled times are not an exact multiple of the time step
+            const unsigned int nstep = step_count(tstart, tend, tstep);
+            boost::numeric::odeint::integrate_n_steps(stepper, func, x, tstart, (tend - tstart)/nstep, nstep);
+        } else {
+            // Declare stepper
+            boost::numeric::odeint::runge_kutta_cash_karp54<State, T, State, T, Algebra> stepper;
+            auto steppercontrolled = boost::numeric::odeint::make_controlled(options.absoluteTolerance, options.relativeTolerance, stepper);
+
+            // Propagate
+            boost::numeric::odeint::integrate_adaptive(steppercontrolled, func, x, tstart, tend, tstep);
+        }
+    }
+
+    template<class T>
+    BasePropagator<T>::BasePropagator(const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation, const StateTypes propstatetype) : m_mu(mu), m_perturbation(perturbation), m_propstatetype(propstatetype) {
 
     }
 
@@ -63,85 +142,314 @@ namespace thames::propagators::basepropagator {
     }
 
     template<class T>
-    void BasePropagator<T>::derivative(const std::vector<T>& RV, std::vector<T>& RVdot, const T t) const {
+    void BasePropagator<T>::derivative(const std::vector<T>& RV, std::vector<T>& RVdot, const T t, const T mu, const BasePerturbation<T>& perturbation) const {
         // Throw error if derivative is not implemented in dervied propagators
         throw std::runtime_error("Derivative must be defined");
     }
 
+    template<class T>
+    void BasePropagator<T>::derivative_ensemble(const std::vector<T>& x, std::vector<T>& dxdt, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const {
+        // Declare member state and state derivative
+        const std::size_t nstate = x.size()/n;
+        std::vector<T> xmember(nstate), dxdtmember(nstate);
+
+        // Iterate through ensemble members
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Gather member state
+            for (std::size_t jj = 0; jj < nstate; jj++)
+                xmember[jj] = x[jj*n + ii];
+
+            // Calculate member state derivative
+            derivative(xmember, dxdtmember, t, mu, perturbation);
+
+            // Scatter member state derivative
+            for (std::size_t jj = 0; jj < nstate; jj++)
+                dxdt[jj*n + ii] = dxdtmember[jj];
+        }
+    }
+
+    template<class T>
+    void BasePropagator<T>::derivative_deviations(const std::vector<T>& x, const std::vector<T>& dxdt, const std::vector<float>& dx, std::vector<float>& ddxdt, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const {
+        // Recombine member states
+        const std::size_t nstate = x.size();
+        std::vector<T> xmembers(nstate*n), dxdtmembers(nstate*n);
+        for (std::size_t jj = 0; jj < nstate; jj++)
+            for (std::size_t ii = 0; ii < n; ii++)
+                xmembers[jj*n + ii] = x[jj] + (T) dx[jj*n + ii];
+
+        // Calculate member state derivatives, and store their deviations
+        derivative_ensemble(xmembers, dxdtmembers, t, n, mu, perturbation);
+        for (std::size_t jj = 0; jj < nstate; jj++)
+            for (std::size_t ii = 0; ii < n; ii++)
+                ddxdt[jj*n + ii] = (float) (dxdtmembers[jj*n + ii] - dxdt[jj]);
+    }
+
+    template<class T>
+    void BasePropagator<T>::derivative_variational(const std::vector<T>& x, std::vector<T>& dxdt, const T t, const T mu, const std::shared_ptr<const BasePerturbation<T>>& perturbation) const {
+        // Calculate state derivative
+        std::vector<T> state(x.begin(), x.begin() + 6), statedot(6);
+        derivative(state, statedot, t, mu, *perturbation);
+        std::copy(statedot.begin(), statedot.end(), dxdt.begin());
+
+        // Convert state to Cartesian
+        const std::vector<T> RV = thames::conversions::universal::convert_state<T>(t, state, mu, m_propstatetype, CARTESIAN, perturbation);
+        const std::vector<T> R(RV.begin(), RV.begin() + 3), V(RV.begin() + 3, RV.end());
+
+        // Calculate Jacobian of the perturbing acceleration
+        std::vector<T> J = perturbation->jacobian(t, R, V);
+
+        // Add Jacobian of the two-body acceleration with respect to the position
+        const T r2 = R[0]*R[0] + R[1]*R[1] + R[2]*R[2];
+        const T r = std::sqrt(r2);
+        const T mur3 = mu/(r2*r);
+        for (std::size_t ii = 0; ii < 3; ii++) {
+            for (std::size_t jj = 0; jj < 3; jj++)
+                J[6*ii + jj] += 3.0*mur3*R[ii]*R[jj]/r2;
+            J[6*ii + ii] -= mur3;
+        }
+
+        // Calculate derivative of the state transition matrix
+        // NOTE: the position rows are the velocity rows of the matrix, and the velocity rows are the Jacobian of the acceleration applied to the matrix
+        const T* Phi = x.data() + 6;
+        T* Phidot = dxdt.data() + 6;
+        for (std::size_t jj = 0; jj < 6; jj++) {
+            for (std::size_t ii = 0; ii < 3; ii++) {
+                Phidot[6*ii + jj] = Phi[6*(ii + 3) + jj];
+                T sum = 0.0;
+                for (std::size_t kk = 0; kk < 6; kk++)
+                    sum += J[6*ii + kk]*Phi[6*kk + jj];
+                Phidot[6*(ii + 3) + jj] = sum;
+            }
+        }
+    }
+
     template<class T>
     std::vector<T> BasePropagator<T>::propagate(T tstart, T tend, T tstep, std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Propagate over a single interval
+        return propagate(std::vector<T>{tstart, tend}, tstep, state, options, statetype)[1];
+    }
+
+    template<class T>
+    std::vector<std::vector<T>> BasePropagator<T>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Declare output vectors
+        std::vector<std::vector<T>> states_propagated(tvec.size());
+
+        // Append initial state to output
+        states_propagated[0] = state;
+
+        // Declare times, factors, gravitational parameter and perturbation in the units of the propagation
+        std::vector<T> tvecprop(tvec);
+        T tstepprop = tstep;
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbation<T>> perturbation = m_perturbation;
+        std::vector<T> x(state);
+
         // Non-dimensionalise
         if (options.isNonDimensional) {
-            // Update factors
-            // TODO: clean-up
-            m_perturbation->set_nondimensional(true);
-            std::vector<T> state_cartesian = thames::conversions::universal::convert_state<T>(tstart, state, m_mu, statetype, CARTESIAN, m_perturbation);
-            *m_factors = thames::conversions::dimensional::calculate_factors(state_cartesian, m_mu);
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
+
+            // Calculate factors
+            std::vector<T> state_cartesian = thames::conversions::universal::convert_state<T>(tvec[0], state, m_mu, statetype, CARTESIAN, m_perturbation);
+            factors = thames::conversions::dimensional::calculate_factors(state_cartesian, m_mu);
 
             // Scale times
-            tstart /= m_factors->time;
-            tend /= m_factors->time;
-            tstep /= m_factors->time;
+            for (T& t : tvecprop)
+                t /= factors.time;
+            tstepprop /= factors.time;
 
             // Scale state
-            state = thames::conversions::universal::nondimensionalise_state(state, statetype, *m_factors);
+            x = thames::conversions::universal::nondimensionalise_state(x, statetype, factors);
+
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
         }
 
-        // Calculate gravitational parameters
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
+        // Convert state
+        x = thames::conversions::universal::convert_state<T>(tvecprop[0], x, mu, statetype, m_propstatetype, perturbation);
 
-        // Set non-dimensional flag
-        m_isNonDimensional = options.isNonDimensional;
+        // Declare state derivative
+        auto func = [this, mu, &perturbation](const std::vector<T>& x, std::vector<T>& dxdt, const T t){return derivative(x, dxdt, t, mu, *perturbation);};
 
-        // Set perturbation non-dimensional flag
-        m_perturbation->set_nondimensional(options.isNonDimensional);
+        // Propagate state between times, keeping it in the units and coordinates of the propagation
+        for (std::size_t ii = 0; ii < tvec.size() - 1; ii++) {
+            // Propagate orbit
+            integrate_interval<T, boost::numeric::odeint::range_algebra>(func, x, tvecprop[ii], tvecprop[ii+1], tstepprop, options);
 
-        // Convert state
-        state = thames::conversions::universal::convert_state<T>(tstart, state, mu, statetype, m_propstatetype, m_perturbation);
+            // Convert copy of the state for output
+            states_propagated[ii+1] = thames::conversions::universal::convert_state<T>(tvecprop[ii+1], x, mu, m_propstatetype, statetype, perturbation);
 
-        // Declare state derivative
-        auto func = [this](const std::vector<T>& x, std::vector<T>& dxdt, const T t){return derivative(x, dxdt, t);};
+            // Re-dimensionalise copy of the state for output
+            if (options.isNonDimensional) {
+                // Time re-dimensionalisation
+                thames::util::profiling::ScopedTimer timer("dimensionalise");
 
-        // Propagate according to the fixed flag
-        if(options.isFixedStep){
-            // Declare stepper
-            boost::numeric::odeint::runge_kutta4<std::vector<T>> stepper;
+                states_propagated[ii+1] = thames::conversions::universal::dimensionalise_state(states_propagated[ii+1], statetype, factors);
+            }
+        }
 
-            // Propagate orbit
-            boost::numeric::odeint::integrate_const(stepper, func, state, tstart, tend, tstep);
-        } else {
-            // Declare stepper
-            boost::numeric::odeint::runge_kutta_cash_karp54<std::vector<T>> stepper;
-            auto steppercontrolled = boost::numeric::odeint::make_controlled(options.absoluteTolerance, options.relativeTolerance, stepper);
+        // Return output vector
+        return states_propagated;
+    }
 
-            // Propagate orbit
-            boost::numeric::odeint::integrate_adaptive(steppercontrolled, func, state, tstart, tend, tstep);
+    template<class T>
+    std::vector<T> BasePropagator<T>::propagate(T tstart, T tend, T tstep, std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<T>& stm) {
+        // Check that input is Cartesian state
+        if (statetype != CARTESIAN)
+            throw std::runtime_error("Unsupported state type");
+
+        // Declare factors, gravitational parameter and perturbation in the units of the propagation
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbation<T>> perturbation = m_perturbation;
+
+        // Non-dimensionalise
+        if (options.isNonDimensional) {
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
+
+            // Calculate factors
+            factors = thames::conversions::dimensional::calculate_factors(state, m_mu);
+
+            // Scale times
+            tstart /= factors.time;
+            tend /= factors.time;
+            tstep /= factors.time;
+
+            // Scale state
+            state = thames::conversions::universal::nondimensionalise_state(state, statetype, factors);
+
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
         }
 
-        // Convert state
-        state = thames::conversions::universal::convert_state<T>(tend, state, mu, m_propstatetype, statetype, m_perturbation);
+        // Declare scales of the Cartesian state variables
+        const std::array<T, 6> scales = {factors.length, factors.length, factors.length, factors.velocity, factors.velocity, factors.velocity};
+
+        // Convert state, and augment with the scaled state transition matrix
+        state = thames::conversions::universal::convert_state<T>(tstart, state, mu, statetype, m_propstatetype, perturbation);
+        std::vector<T> x(42);
+        std::copy(state.begin(), state.end(), x.begin());
+        for (std::size_t ii = 0; ii < 6; ii++)
+            for (std::size_t jj = 0; jj < 6; jj++)
+                x[6 + 6*ii + jj] = stm[6*ii + jj]*scales[jj]/scales[ii];
+
+        // Declare augmented state derivative
+        auto func = [this, mu, &perturbation](const std::vector<T>& x, std::vector<T>& dxdt, const T t){return derivative_variational(x, dxdt, t, mu, perturbation);};
+
+        // Propagate orbit and state transition matrix
+        integrate_interval<T, boost::numeric::odeint::range_algebra>(func, x, tstart, tend, tstep, options);
+
+        // Extract and convert state
+        state.assign(x.begin(), x.begin() + 6);
+        state = thames::conversions::universal::convert_state<T>(tend, state, mu, m_propstatetype, statetype, perturbation);
+
+        // Extract and rescale state transition matrix
+        for (std::size_t ii = 0; ii < 6; ii++)
+            for (std::size_t jj = 0; jj < 6; jj++)
+                stm[6*ii + jj] = x[6 + 6*ii + jj]*scales[ii]/scales[jj];
 
         // Re-dimensionalise
         if (options.isNonDimensional) {
-            state = thames::conversions::universal::dimensionalise_state(state, statetype, *m_factors);
+            // Time re-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("dimensionalise");
+
+            state = thames::conversions::universal::dimensionalise_state(state, statetype, factors);
         }
 
         // Return final state
         return state;
+    }
 
+    template<class T>
+    std::vector<std::vector<T>> BasePropagator<T>::propagate(const T tstart, const T tend, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Propagate over a single interval
+        return propagate(std::vector<T>{tstart, tend}, tstep, states, options, statetype)[1];
     }
 
     template<class T>
-    std::vector<std::vector<T>> BasePropagator<T>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype) {
+    std::vector<std::vector<std::vector<T>>> BasePropagator<T>::propagate_ensemble(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Ensemble size
+        const std::size_t n = states.size();
+        const std::size_t nstate = states[0].size();
+
         // Declare output vectors
-        std::vector<std::vector<T>> states_propagated(tvec.size());
+        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), states);
 
-        // Append initial state to output
-        states_propagated[0] = state;
+        // Declare times, factors, gravitational parameter and perturbation in the units of the propagation
+        std::vector<T> tvecprop(tvec);
+        T tstepprop = tstep;
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbation<T>> perturbation = m_perturbation;
+        std::vector<std::vector<T>> states_working(states);
 
-        // Propagate state between times
-        for (std::size_t ii = 0; ii < tvec.size() - 1; ii++) {
-            states_propagated[ii+1] = propagate(tvec[ii], tvec[ii+1], tstep, states_propagated[ii], options, statetype);
+        // Non-dimensionalise
+        if (options.isNonDimensional) {
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
+
+            // Calculate mean Cartesian state
+            std::vector<T> state_mean(6, 0.0);
+            for (const std::vector<T>& state : states) {
+                const std::vector<T> state_cartesian = thames::conversions::universal::convert_state<T>(tvec[0], state, m_mu, statetype, CARTESIAN, m_perturbation);
+                for (std::size_t jj = 0; jj < 6; jj++)
+                    state_mean[jj] += state_cartesian[jj]/n;
+            }
+
+            // Calculate factors
+            factors = thames::conversions::dimensional::calculate_factors(state_mean, m_mu);
+
+            // Scale times
+            for (T& t : tvecprop)
+                t /= factors.time;
+            tstepprop /= factors.time;
+
+            // Scale states
+            for (std::vector<T>& state : states_working)
+                state = thames::conversions::universal::nondimensionalise_state(state, statetype, factors);
+
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
+        }
+
+        // Convert and pack states component-wise
+        std::vector<T> x(nstate*n);
+        for (std::size_t ii = 0; ii < n; ii++) {
+            const std::vector<T> state = thames::conversions::universal::convert_state<T>(tvecprop[0], states_working[ii], mu, statetype, m_propstatetype, perturbation);
+            for (std::size_t jj = 0; jj < nstate; jj++)
+                x[jj*n + ii] = state[jj];
+        }
+
+        // Declare state derivative
+        auto func = [this, n, mu, &perturbation](const std::vector<T>& x, std::vector<T>& dxdt, const T t){return derivative_ensemble(x, dxdt, t, n, mu, *perturbation);};
+
+        // Propagate states between times, keeping them in the units and coordinates of the propagation
+        // NOTE: the default error checker takes the maximum error over all components, and therefore the worst-case error over the ensemble
+        for (std::size_t kk = 0; kk < tvec.size() - 1; kk++) {
+            // Propagate orbits
+            integrate_interval<T, boost::numeric::odeint::range_algebra>(func, x, tvecprop[kk], tvecprop[kk+1], tstepprop, options);
+
+            // Unpack and convert copies of the states for output
+            for (std::size_t ii = 0; ii < n; ii++) {
+                std::vector<T> state(nstate);
+                for (std::size_t jj = 0; jj < nstate; jj++)
+                    state[jj] = x[jj*n + ii];
+                states_propagated[kk+1][ii] = thames::conversions::universal::convert_state<T>(tvecprop[kk+1], state, mu, m_propstatetype, statetype, perturbation);
+            }
+
+            // Re-dimensionalise copies of the states for output
+            if (options.isNonDimensional) {
+                // Time re-dimensionalisation
+                thames::util::profiling::ScopedTimer timer("dimensionalise");
+
+                for (std::vector<T>& state : states_propagated[kk+1])
+                    state = thames::conversions::universal::dimensionalise_state(state, statetype, factors);
+            }
         }
 
         // Return output vector
@@ -149,30 +457,414 @@ namespace thames::propagators::basepropagator {
     }
 
     template<class T>
-    std::vector<std::vector<T>> BasePropagator<T>::propagate(const T tstart, const T tend, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype) {
-        // Declare output states
-        std::vector<std::vector<T>> states_propagated(states);
+    std::vector<std::vector<std::vector<T>>> BasePropagator<T>::propagate_ensemble_mixed(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Ensemble size
+        const std::size_t n = states.size();
+        const std::size_t nstate = states[0].size();
 
-        // Iterate through states
-        for (std::vector<T>& state : states_propagated) {
-            state = propagate(tstart, tend, tstep, state, options, statetype);
+        // Declare output vectors
+        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), states);
+
+        // Calculate mean Cartesian state as the nominal
+        std::vector<T> state_nominal(6, 0.0);
+        for (const std::vector<T>& state : states) {
+            const std::vector<T> state_cartesian = thames::conversions::universal::convert_state<T>(tvec[0], state, m_mu, statetype, CARTESIAN, m_perturbation);
+            for (std::size_t jj = 0; jj < 6; jj++)
+                state_nominal[jj] += state_cartesian[jj]/n;
+        }
+
+        // Declare times, factors, gravitational parameter and perturbation in the units of the propagation
+        std::vector<T> tvecprop(tvec);
+        T tstepprop = tstep;
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbation<T>> perturbation = m_perturbation;
+        std::vector<std::vector<T>> states_working(states);
+
+        // Non-dimensionalise
+        if (options.isNonDimensional) {
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
+
+            // Calculate factors
+            factors = thames::conversions::dimensional::calculate_factors(state_nominal, m_mu);
+
+            // Scale times
+            for (T& t : tvecprop)
+                t /= factors.time;
+            tstepprop /= factors.time;
+
+            // Scale states
+            state_nominal = thames::conversions::universal::nondimensionalise_state(state_nominal, CARTESIAN, factors);
+            for (std::vector<T>& state : states_working)
+                state = thames::conversions::universal::nondimensionalise_state(state, statetype, factors);
+
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
+        }
+
+        // Convert nominal, and pack deviations of the converted states component-wise
+        // NOTE: deviations of the GEqOE generalised mean longitude are wrapped, so that members either side of the branch cut remain close to the nominal
+        MixedPrecisionState<T, float> x;
+        x.nominal = thames::conversions::universal::convert_state<T>(tvecprop[0], state_nominal, mu, CARTESIAN, m_propstatetype, perturbation);
+        x.deviations.resize(nstate*n);
+        for (std::size_t ii = 0; ii < n; ii++) {
+            const std::vector<T> state = thames::conversions::universal::convert_state<T>(tvecprop[0], states_working[ii], mu, statetype, m_propstatetype, perturbation);
+            for (std::size_t jj = 0; jj < nstate; jj++) {
+                T deviation = state[jj] - x.nominal[jj];
+                if (m_propstatetype == GEQOE && jj == 3)
+                    deviation = thames::util::angles::angle_wrap(deviation);
+                x.deviations[jj*n + ii] = (float) deviation;
+            }
+        }
+
+        // Declare state derivative
+        auto func = [this, n, mu, &perturbation](const MixedPrecisionState<T, float>& x, MixedPrecisionState<T, float>& dxdt, const T t) {
+            derivative(x.nominal, dxdt.nominal, t, mu, *perturbation);
+            derivative_deviations(x.nominal, dxdt.nominal, x.deviations, dxdt.deviations, t, n, mu, *perturbation);
+        };
+
+        // Propagate states between times, keeping them in the units and coordinates of the propagation
+        for (std::size_t kk = 0; kk < tvec.size() - 1; kk++) {
+            // Propagate orbits
+            integrate_interval<T, MixedPrecisionAlgebra>(func, x, tvecprop[kk], tvecprop[kk+1], tstepprop, options);
+
+            // Recombine and convert copies of the states for output
+            for (std::size_t ii = 0; ii < n; ii++) {
+                std::vector<T> state(nstate);
+                for (std::size_t jj = 0; jj < nstate; jj++)
+                    state[jj] = x.nominal[jj] + (T) x.deviations[jj*n + ii];
+                states_propagated[kk+1][ii] = thames::conversions::universal::convert_state<T>(tvecprop[kk+1], state, mu, m_propstatetype, statetype, perturbation);
+            }
+
+            // Re-dimensionalise copies of the states for output
+            if (options.isNonDimensional) {
+                // Time re-dimensionalisation
+                thames::util::profiling::ScopedTimer timer("dimensionalise");
+
+                for (std::vector<T>& state : states_propagated[kk+1])
+                    state = thames::conversions::universal::dimensionalise_state(state, statetype, factors);
+            }
         }
 
-        // Return states
+        // Return output vector
         return states_propagated;
     }
 
     template<class T>
     std::vector<std::vector<std::vector<T>>> BasePropagator<T>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype) {
         // Declare output vectors
-        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size());
+        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), states);
+
+        // Propagate states individually if ensembles are disabled
+        if (options.ensembleSize < 2) {
+            // Iterate through states
+            for (std::size_t jj = 0; jj < states.size(); jj++) {
+                const std::vector<std::vector<T>> trajectory = propagate(tvec, tstep, states[jj], options, statetype);
+                for (std::size_t ii = 1; ii < tvec.size(); ii++)
+                    states_propagated[ii][jj] = trajectory[ii];
+            }
+
+            // Return output vector
+            return states_propagated;
+        }
 
-        // Append initial state to output
-        states_propagated[0] = states;
+        // Calculate ranges
+        // NOTE: timesteps scale with range, so neighbouring states in range are grouped together
+        std::vector<T> ranges(states.size());
+        for (std::size_t ii = 0; ii < states.size(); ii++) {
+            const std::vector<T> state_cartesian = thames::conversions::universal::convert_state<T>(tvec[0], states[ii], m_mu, statetype, CARTESIAN, m_perturbation);
+            ranges[ii] = std::sqrt(state_cartesian[0]*state_cartesian[0] + state_cartesian[1]*state_cartesian[1] + state_cartesian[2]*state_cartesian[2]);
+        }
+
+        // Order states by range
+        std::vector<std::size_t> order(states.size());
+        for (std::size_t ii = 0; ii < order.size(); ii++)
+            order[ii] = ii;
+        std::stable_sort(order.begin(), order.end(), [&ranges](const std::size_t a, const std::size_t b){return ranges[a] < ranges[b];});
+
+        // Iterate through ensembles
+        for (std::size_t start = 0; start < order.size(); start += options.ensembleSize) {
+            // Gather ensemble states
+            const std::size_t end = std::min<std::size_t>(start + options.ensembleSize, order.size());
+            std::vector<std::vector<T>> ensemble;
+            ensemble.reserve(end - start);
+            for (std::size_t ii = start; ii < end; ii++)
+                ensemble.push_back(states[order[ii]]);
+
+            // Propagate ensemble through all times, with the deviations in single precision if requested
+            const std::vector<std::vector<std::vector<T>>> trajectories = options.isMixedPrecision ? propagate_ensemble_mixed(tvec, tstep, ensemble, options, statetype) : propagate_ensemble(tvec, tstep, ensemble, options, statetype);
+
+            // Scatter ensemble states
+            for (std::size_t kk = 1; kk < tvec.size(); kk++)
+                for (std::size_t ii = start; ii < end; ii++)
+                    states_propagated[kk][order[ii]] = trajectories[kk][ii - start];
+        }
 
-        // Propagate state between times
+        // Return output vector
+        return states_propagated;
+    }
+
+    template<class T>
+    std::vector<std::vector<std::vector<T>>> BasePropagator<T>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<std::vector<std::vector<T>>>& stms) {
+        // Declare output vectors
+        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), states);
+
+        // Initialise state transition matrices to identity
+        std::vector<T> identity(36, 0.0);
+        for (std::size_t ii = 0; ii < 6; ii++)
+            identity[7*ii] = 1.0;
+        stms.assign(tvec.size(), std::vector<std::vector<T>>(states.size(), identity));
+
+        // Propagate each state between times, continuing its state transition matrix
         for (std::size_t ii = 0; ii < tvec.size() - 1; ii++) {
-            states_propagated[ii+1] = propagate(tvec[ii], tvec[ii+1], tstep, states_propagated[ii], options, statetype);
+            for (std::size_t jj = 0; jj < states.size(); jj++) {
+                stms[ii+1][jj] = stms[ii][jj];
+                states_propagated[ii+1][jj] = propagate(tvec[ii], tvec[ii+1], tstep, states_propagated[ii][jj], options, statetype, stms[ii+1][jj]);
+            }
+        }
+
+        // Return output vector
+        return states_propagated;
+    }
+
+    template<class T>
+    std::vector<std::vector<T>> BasePropagator<T>::propagate_unscented(const std::vector<T> tvec, const T tstep, const std::vector<T> mean, const std::vector<T> covariance, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<std::vector<T>>& covariances) {
+        // Generate sigma points
+        std::vector<std::vector<T>> points;
+        std::vector<T> weightsMean, weightsCovariance;
+        thames::util::covariance::sigma_points(mean, covariance, options.unscentedAlpha, options.unscentedBeta, options.unscentedKappa, points, weightsMean, weightsCovariance);
+
+        // Propagate sigma points
+        std::vector<std::vector<std::vector<T>>> points_propagated;
+        if (options.unscentedThreads < 2) {
+            // Propagate sigma points as a set
+            points_propagated = propagate(tvec, tstep, points, options, statetype);
+        } else {
+            // Propagate sigma points individually across the pool
+            std::vector<std::vector<std::vector<T>>> trajectories(points.size());
+            {
+                thames::util::threadpool::WorkStealingPool pool(std::min<std::size_t>(options.unscentedThreads, points.size()));
+                for (std::size_t jj = 0; jj < points.size(); jj++)
+                    pool.submit([&, jj]() {trajectories[jj] = propagate(tvec, tstep, points[jj], options, statetype);});
+                pool.wait();
+            }
+
+            // Gather sigma points for each time
+            points_propagated.assign(tvec.size(), std::vector<std::vector<T>>(points.size()));
+            for (std::size_t ii = 0; ii < tvec.size(); ii++)
+                for (std::size_t jj = 0; jj < points.size(); jj++)
+                    points_propagated[ii][jj] = trajectories[jj][ii];
+        }
+
+        // Reconstruct mean and covariance at each time
+        std::vector<std::vector<T>> means(tvec.size());
+        covariances.resize(tvec.size());
+        for (std::size_t ii = 0; ii < tvec.size(); ii++)
+            thames::util::covariance::reconstruct(points_propagated[ii], weightsMean, weightsCovariance, means[ii], covariances[ii]);
+
+        // Return mean states
+        return means;
+    }
+
+    template<class T>
+    std::vector<T> BasePropagator<T>::propagate(T tstart, T tend, T tstep, std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype, const std::vector<std::shared_ptr<const BaseEvent<T>>>& events, std::vector<EventOccurrence<T>>& occurrences) {
+        // Declare factors, gravitational parameter and perturbation in the units of the propagation
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbation<T>> perturbation = m_perturbation;
+
+        // Non-dimensionalise
+        if (options.isNonDimensional) {
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
+
+            // Calculate factors
+            std::vector<T> state_cartesian = thames::conversions::universal::convert_state<T>(tstart, state, m_mu, statetype, CARTESIAN, m_perturbation);
+            factors = thames::conversions::dimensional::calculate_factors(state_cartesian, m_mu);
+
+            // Scale times
+            tstart /= factors.time;
+            tend /= factors.time;
+            tstep /= factors.time;
+
+            // Scale state
+            state = thames::conversions::universal::nondimensionalise_state(state, statetype, factors);
+
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
+        }
+
+        // Convert state
+        state = thames::conversions::universal::convert_state<T>(tstart, state, mu, statetype, m_propstatetype, perturbation);
+
+        // Declare state derivative
+        auto func = [this, mu, &perturbation](const std::vector<T>& x, std::vector<T>& dxdt, const T t){return derivative(x, dxdt, t, mu, *perturbation);};
+
+        // Declare steppers, with dense output for adaptive propagation
+        boost::numeric::odeint::runge_kutta4<std::vector<T>, T> stepperfixed;
+        auto stepperdense = boost::numeric::odeint::make_dense_output(options.absoluteTolerance, options.relativeTolerance, boost::numeric::odeint::runge_kutta_dopri5<std::vector<T>, T>());
+
+        // Declare conversion to the physical time and the output state
+        auto physical_time = [&](const T t) {return options.isNonDimensional ? t*factors.time : t;};
+        auto output_state = [&](const T t, const std::vector<T>& x) {
+            std::vector<T> x_output = thames::conversions::universal::convert_state<T>(t, x, mu, m_propstatetype, statetype, perturbation);
+            if (options.isNonDimensional)
+                x_output = thames::conversions::universal::dimensionalise_state(x_output, statetype, factors);
+            return x_output;
+        };
+
+        // Declare event functions in physical units
+        auto event_values = [&](const T t, const std::vector<T>& x) {
+            std::vector<T> RV = thames::conversions::universal::convert_state<T>(t, x, mu, m_propstatetype, CARTESIAN, perturbation);
+            if (options.isNonDimensional)
+                RV = thames::conversions::universal::dimensionalise_state(RV, CARTESIAN, factors);
+            std::vector<T> values(events.size());
+            for (std::size_t ii = 0; ii < events.size(); ii++)
+                values[ii] = events[ii]->value(physical_time(t), RV);
+            return values;
+        };
+
+        // Calculate number of steps for fixed-step propagation
+        const unsigned int nstep = step_count(tstart, tend, tstep);
+        unsigned int istep = 0;
+
+        // Evaluate events at the start
+        T t = tstart;
+        std::vector<T> values = event_values(t, state);
+        bool isTerminated = false;
+
+        // Time integration, including event location
+        thames::util::profiling::ScopedTimer timer_integration("integrate");
+
+        // Initialise dense output stepper
+        if (!options.isFixedStep)
+            stepperdense.initialize(state, tstart, tstep);
+
+        // Step until the end time or a terminal event
+        while (t < tend && !isTerminated) {
+            // Store start of step
+            const T t0 = t;
+            const std::vector<T> x0(state);
+
+            // Take step according to the fixed flag
+            if (options.isFixedStep) {
+                istep++;
+                t = (istep == nstep) ? tend : tstart + istep*(tend - tstart)/nstep;
+                stepperfixed.do_step(func, x0, t0, state, t - t0);
+            } else {
+                // Take step, and interpolate to the end time if the step overshoots
+                stepperdense.do_step(func);
+                t = std::min(stepperdense.current_time(), tend);
+                if (t < stepperdense.current_time()) {
+                    stepperdense.calc_state(t, state);
+                } else {
+                    state = stepperdense.current_state();
+                }
+            }
+
+            // Declare dense output within the step
+            // NOTE: fixed steps are interpolated with the cubic Hermite polynomial through the states and derivatives at the ends of the step
+            std::vector<T> dxdt0, dxdt1;
+            auto dense = [&](const T tdense) {
+                std::vector<T> x(state.size());
+                if (!options.isFixedStep) {
+                    stepperdense.calc_state(tdense, x);
+                } else {
+                    if (dxdt0.empty()) {
+                        dxdt0.resize(state.size());
+                        dxdt1.resize(state.size());
+                        func(x0, dxdt0, t0);
+                        func(state, dxdt1, t);
+                    }
+                    const T h = t - t0;
+                    const T s = (tdense - t0)/h;
+                    const T h00 = (1.0 + 2.0*s)*(1.0 - s)*(1.0 - s);
+                    const T h10 = s*(1.0 - s)*(1.0 - s);
+                    const T h01 = s*s*(3.0 - 2.0*s);
+                    const T h11 = s*s*(s - 1.0);
+                    for (std::size_t ii = 0; ii < x.size(); ii++)
+                        x[ii] = h00*x0[ii] + h10*h*dxdt0[ii] + h01*state[ii] + h11*h*dxdt1[ii];
+                }
+                return x;
+            };
+
+            // Evaluate events at the end of the step
+            const std::vector<T> values_step = event_values(t, state);
+
+            // Locate sign changes in the requested directions
+            std::vector<std::pair<T, std::size_t>> located;
+            for (std::size_t ii = 0; ii < events.size(); ii++) {
+                const bool isIncreasing = values[ii] < 0.0 && values_step[ii] >= 0.0;
+                const bool isDecreasing = values[ii] >= 0.0 && values_step[ii] < 0.0;
+                const int direction = events[ii]->get_direction();
+                if (!((isIncreasing && direction >= 0) || (isDecreasing && direction <= 0)))
+                    continue;
+
+                // Refine time of the sign change on the dense output, with the end values of the step bracketing the root
+                std::function<T (T)> func_event = [&, ii](T tevent) {
+                    if (tevent <= t0)
+                        return values[ii];
+                    if (tevent >= t)
+                        return values_step[ii];
+                    return event_values(tevent, dense(tevent))[ii];
+                };
+                const T tol = std::max<T>(1e-10*(t - t0), 16.0*std::numeric_limits<T>::epsilon()*std::fabs(t));
+                located.push_back({thames::util::root::brent(func_event, t0, t, tol), ii});
+            }
+
+            // Record occurrences in time order, stopping at the first terminal event
+            std::sort(located.begin(), located.end());
+            for (const std::pair<T, std::size_t>& event : located) {
+                const std::vector<T> x_event = dense(event.first);
+                occurrences.push_back({event.second, 0, physical_time(event.first), output_state(event.first, x_event), events[event.second]->is_terminal()});
+                if (occurrences.back().isTerminal) {
+                    t = event.first;
+                    state = x_event;
+                    isTerminated = true;
+                    break;
+                }
+            }
+
+            // Update event values
+            values = values_step;
+        }
+        timer_integration.stop();
+
+        // Return final state
+        return output_state(t, state);
+    }
+
+    template<class T>
+    std::vector<std::vector<std::vector<T>>> BasePropagator<T>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const std::vector<std::shared_ptr<const BaseEvent<T>>>& events, std::vector<EventOccurrence<T>>& occurrences) {
+        // Declare output vectors
+        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), states);
+
+        // Iterate through states
+        for (std::size_t ii = 0; ii < states.size(); ii++) {
+            bool isTerminated = false;
+
+            // Propagate state between times
+            for (std::size_t jj = 0; jj < tvec.size() - 1; jj++) {
+                // Hold state after a terminal event
+                if (isTerminated) {
+                    states_propagated[jj+1][ii] = states_propagated[jj][ii];
+                    continue;
+                }
+
+                // Propagate state
+                std::vector<EventOccurrence<T>> occurrences_interval;
+                states_propagated[jj+1][ii] = propagate(tvec[jj], tvec[jj+1], tstep, states_propagated[jj][ii], options, statetype, events, occurrences_interval);
+
+                // Record occurrences against the state
+                for (EventOccurrence<T>& occurrence : occurrences_interval) {
+                    occurrence.sample = ii;
+                    isTerminated = isTerminated || occurrence.isTerminal;
+                    occurrences.push_back(occurrence);
+                }
+            }
         }
 
         // Return output vector
@@ -180,6 +872,8 @@ namespace thames::propagators::basepropagator {
     }
 
     template class BasePropagator<double>;
+    template class BasePropagator<float>;
+    template class BasePropagator<long double>;
 
     /////////////////
     // Polynomials //
@@ -190,8 +884,53 @@ namespace thames::propagators::basepropagator {
     using namespace smartuq::integrator;
     using namespace smartuq::polynomial;
 
+    /**
+     * @brief Integrate a polynomial state over an interval, with the integrator according to the fixed flag.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     * @tparam T Numeric type.
+     * @tparam P Polynomial type.
+     * @param[in] dyn Dynamics object, in the units of the propagation.
+     * @param[in,out] x State, in the units and coordinates of the propagation.
+     * @param[in] tstart Start time, in the units of the propagation.
+     * @param[in] tend End time, in the units of the propagation.
+     * @param[in] tstep Fixed or initial timestep, in the units of the propagation.
+     * @param[in] options Propagator options.
+     */
+    template<class T, template<class> class P>
+    void integrate_interval(const std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>>& dyn, std::vector<P<T>>& x, const T tstart, const T tend, const T tstep, const PropagatorParameters<T>& options) {
+        // Time integration
+        thames::util::profiling::ScopedTimer timer("integrate");
+
+        // Calculate number of steps based on time step
+        const unsigned int nstep = step_count(tstart, tend, tstep);
+
+        // Create final state vector
+        std::vector<P<T>> xfinal(x);
+
+        // Propagate according to the fixed flag
+        if(options.isFixedStep){
+            // Create integrator
+            rk4<P<T>> integrator(dyn.get());
+
+            // Integrate state
+            integrator.integrate(tstart, tend, nstep, x, xfinal);
+        } else {
+            // Create integrator
+            rk45<P<T>> integrator(dyn.get(), options.absoluteTolerance, options.relativeTolerance);
+
+            // Integrate state
+            integrator.integrate(tstart, tend, nstep, x, xfinal);
+        }
+
+        // Store final state
+        x = xfinal;
+    }
+
     template<class T, template<class> class P>
-    BasePropagatorPolynomialDynamics<T, P>::BasePropagatorPolynomialDynamics(std::string name, const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<const DimensionalFactors<T>> factors) : smartuq::dynamics::base_dynamics<P<T>>(name), m_mu(mu), m_perturbation(perturbation), m_factors(factors) {
+    BasePropagatorPolynomialDynamics<T, P>::BasePropagatorPolynomialDynamics(std::string name, const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) : smartuq::dynamics::base_dynamics<P<T>>(name), m_mu(mu), m_perturbation(perturbation) {
 
     }
 
@@ -210,98 +949,140 @@ namespace thames::propagators::basepropagator {
     template class BasePropagatorPolynomialDynamics<double, chebyshev_polynomial>;
 
     template<class T, template<class> class P>
-    BasePropagatorPolynomial<T, P>::BasePropagatorPolynomial(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors, const std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> dyn, const StateTypes propstatetype) : m_mu(mu), m_perturbation(perturbation), m_factors(factors), m_dyn(dyn), m_propstatetype(propstatetype) {
+    BasePropagatorPolynomial<T, P>::BasePropagatorPolynomial(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation, const StateTypes propstatetype) : m_mu(mu), m_perturbation(perturbation), m_propstatetype(propstatetype) {
 
     }
 
     template<class T, template<class> class P>
-    std::vector<P<T>> BasePropagatorPolynomial<T, P>::propagate(T tstart, T tend, T tstep, std::vector<P<T>> state, const PropagatorParameters<T> options, const StateTypes statetype) {       
+    std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> BasePropagatorPolynomial<T, P>::create_dynamics(const T mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) const {
+        // Throw error if dynamics are not implemented in derived propagators
+        throw std::runtime_error("Dynamics must be defined");
+    }
+
+    template<class T, template<class> class P>
+    std::vector<P<T>> BasePropagatorPolynomial<T, P>::propagate(T tstart, T tend, T tstep, std::vector<P<T>> state, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Propagate over a single interval
+        return propagate(std::vector<T>{tstart, tend}, tstep, state, options, statetype)[1];
+    }
+
+    template<class T, template <class> class P>
+    std::vector<std::vector<P<T>>> BasePropagatorPolynomial<T, P>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<P<T>> state, const PropagatorParameters<T> options, const StateTypes statetype) {
+        // Lease multiplication table for the duration of the propagation
+        thames::util::polynomials::MultiplicationTableLease<T, P> lease(state[0].get_nvar(), state[0].get_degree());
+
+        // Declare output vectors
+        std::vector<std::vector<P<T>>> states_propagated(tvec.size());
+
+        // Append initial states to output
+        states_propagated[0] = state;
+
+        // Declare times, factors, gravitational parameter and perturbation in the units of the propagation
+        std::vector<T> tvecprop(tvec);
+        T tstepprop = tstep;
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation = m_perturbation;
+        std::vector<P<T>> x(state);
+
         // Non-dimensionalise
         if (options.isNonDimensional) {
-            // Update factors
-            // TODO: clean-up
-            m_perturbation->set_nondimensional(true);
-            std::vector<P<T>> state_cartesian = thames::conversions::universal::convert_state<T, P>(tstart, state, m_mu, statetype, CARTESIAN, m_perturbation);
-            *m_factors = thames::conversions::dimensional::calculate_factors(state_cartesian, m_mu);
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
+
+            // Calculate factors
+            std::vector<P<T>> state_cartesian = thames::conversions::universal::convert_state<T, P>(tvec[0], state, m_mu, statetype, CARTESIAN, m_perturbation);
+            factors = thames::conversions::dimensional::calculate_factors(state_cartesian, m_mu);
 
             // Scale times
-            tstart /= m_factors->time;
-            tend /= m_factors->time;
-            tstep /= m_factors->time;
+            for (T& t : tvecprop)
+                t /= factors.time;
+            tstepprop /= factors.time;
 
             // Scale state
-            state = thames::conversions::universal::nondimensionalise_state(state, statetype, *m_factors);
-        }
-
-        // Calculate gravitational parameters
-        const T mu = (options.isNonDimensional) ? m_mu/m_factors->grav : m_mu;
+            x = thames::conversions::universal::nondimensionalise_state(x, statetype, factors);
 
-        // Set non-dimensional flag
-        m_dyn->m_isNonDimensional = options.isNonDimensional;
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
+        }
 
-        // Set perturbation non-dimensional flag
-        m_perturbation->set_nondimensional(options.isNonDimensional);
+        // Create dynamics
+        const std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> dyn = create_dynamics(mu, perturbation);
 
         // Convert state
-        state = thames::conversions::universal::convert_state<T, P>(tstart, state, mu, statetype, m_propstatetype, m_perturbation);
-        
-        // Calculate number of steps based on time step
-        unsigned int nstep = (int) ceil((tend - tstart)/tstep);
+        x = thames::conversions::universal::convert_state<T, P>(tvecprop[0], x, mu, statetype, m_propstatetype, perturbation);
 
-        // Create final state vector
-        std::vector<P<T>> statefinal(state);
-
-        // Propagate according to the fixed flag
-        if(options.isFixedStep){
-            // Create integrator
-            rk4<P<T>> integrator(m_dyn.get());
+        // Propagate state between times, keeping it in the units and coordinates of the propagation
+        for (std::size_t ii = 0; ii < tvec.size() - 1; ii++) {
+            // Propagate polynomials
+            integrate_interval<T, P>(dyn, x, tvecprop[ii], tvecprop[ii+1], tstepprop, options);
 
-            // Integrate state
-            integrator.integrate(tstart, tend, nstep, state, statefinal);  
-        } else {
-            // Create integrator
-            rk45<P<T>> integrator(m_dyn.get(), options.absoluteTolerance, options.relativeTolerance);
+            // Convert copy of the state for output
+            states_propagated[ii+1] = thames::conversions::universal::convert_state<T, P>(tvecprop[ii+1], x, mu, m_propstatetype, statetype, perturbation);
 
-            // Integrate state
-            integrator.integrate(tstart, tend, nstep, state, statefinal);  
-        }
+            // Re-dimensionalise copy of the state for output
+            if (options.isNonDimensional) {
+                // Time re-dimensionalisation
+                thames::util::profiling::ScopedTimer timer("dimensionalise");
 
-        // Convert state
-        statefinal = thames::conversions::universal::convert_state<T, P>(tend, statefinal, mu, m_propstatetype, statetype, m_perturbation);
-        
-        // Re-dimensionalise
-        if (options.isNonDimensional) {
-            statefinal = thames::conversions::universal::dimensionalise_state(statefinal, statetype, *m_factors);
+                states_propagated[ii+1] = thames::conversions::universal::dimensionalise_state(states_propagated[ii+1], statetype, factors);
+            }
         }
 
-        // Return final state
-        return statefinal;        
+        // Return output vector
+        return states_propagated;
     }
 
     template<class T, template <class> class P>
-    std::vector<std::vector<P<T>>> BasePropagatorPolynomial<T, P>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<P<T>> state, const PropagatorParameters<T> options, const StateTypes statetype) {
-        // Declare output vectors
-        std::vector<std::vector<P<T>>> states_propagated(tvec.size());
+    std::vector<std::vector<T>> BasePropagatorPolynomial<T, P>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<T> state, const PropagatorParameters<T> options, const StateTypes statetype, std::vector<std::vector<T>>& stms) {
+        // Check that input is Cartesian state
+        if(statetype != thames::constants::statetypes::CARTESIAN)
+            throw std::runtime_error("Unsupported state type");
 
-        // Append initial states to output
-        states_propagated[0] = state;
+        // Check that the polynomials are Taylor polynomials
+        // NOTE: truncated Chebyshev multiplication does not preserve the linear coefficients as derivatives
+        if(thames::util::polynomials::polynomial_basis<P>() != thames::util::polynomials::MONOMIAL)
+            throw std::runtime_error("State transition matrix extraction requires Taylor polynomials");
 
-        // Propagate state between times
-        // TODO: store intermediate in propagation state
-        for (std::size_t ii = 0; ii < tvec.size() - 1; ii++) {
-            states_propagated[ii+1] = propagate(tvec[ii], tvec[ii+1], tstep, states_propagated[ii], options, statetype);
+        // Lease multiplication table for the duration of the propagation
+        thames::util::polynomials::MultiplicationTableLease<T, P> lease(state.size(), 1);
+
+        // Generate first-degree polynomials with unit half-width
+        std::vector<P<T>> statepolynomial;
+        thames::conversions::polynomial::states_to_polynomial(state, std::vector<T>(state.size(), 1.0), 1, statepolynomial);
+
+        // Propagate polynomials
+        std::vector<std::vector<P<T>>> statepolynomials = propagate(tvec, tstep, statepolynomial, options, statetype);
+
+        // Extract states and state transition matrices from the constant and linear coefficients
+        std::vector<std::vector<T>> states_propagated(tvec.size(), std::vector<T>(state.size()));
+        stms.assign(tvec.size(), std::vector<T>(state.size()*state.size()));
+        for(std::size_t ii=0; ii<tvec.size(); ii++){
+            for(std::size_t jj=0; jj<state.size(); jj++){
+                const std::vector<T> coefficients = statepolynomials[ii][jj].get_coeffs();
+                states_propagated[ii][jj] = coefficients[0];
+                for(std::size_t kk=0; kk<state.size(); kk++)
+                    stms[ii][state.size()*jj + kk] = coefficients[1 + kk];
+            }
         }
 
-        // Return output vector
+        // Return propagated states
         return states_propagated;
     }
 
     template<class T, template <class> class P>
-    std::vector<std::vector<T>> BasePropagatorPolynomial<T, P>::propagate(const T tstart, const T tend, const T tstep, std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree) {
+    std::vector<std::vector<T>> BasePropagatorPolynomial<T, P>::propagate(const T tstart, const T tend, const T tstep, std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, const unsigned int maxSplitDepth) {
         // Check that input is Cartesian state
         if(statetype != thames::constants::statetypes::CARTESIAN)
             throw std::runtime_error("Unsupported state type");
 
+        // Propagate with domain splitting, if enabled
+        if(splitThreshold > 0.0 && maxSplitDepth > 0)
+            return propagate({tstart, tend}, tstep, states, options, statetype, degree, threshold, splitThreshold, maxSplitDepth).back();
+
+        // Lease multiplication table for the duration of the propagation
+        thames::util::polynomials::MultiplicationTableLease<T, P> lease(states[0].size(), degree);
+
         // Generate polynomials
         std::vector<P<T>> statepolynomial;
         std::vector<T> lower, upper;
@@ -314,52 +1095,278 @@ namespace thames::propagators::basepropagator {
         statepolynomial = propagate(tstart, tend, tstep, statepolynomial, options, statetype);
  
         // Sample polynomials
-        states = thames::util::polynomials::evaluate_polynomials(statepolynomial, samples);
+        states = thames::util::polynomials::evaluate_polynomials(statepolynomial, samples, threshold);
 
         // Return propgated states
         return states;
     }
 
     template<class T, template <class> class P>
-    std::vector<std::vector<std::vector<T>>> BasePropagatorPolynomial<T, P>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree) {
+    std::vector<std::vector<std::vector<T>>> BasePropagatorPolynomial<T, P>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, const unsigned int maxSplitDepth) {
+        // Check that input is Cartesian state
+        if(statetype != thames::constants::statetypes::CARTESIAN)
+            throw std::runtime_error("Unsupported state type");
+
+        // Propagate states with domain splitting
+        return propagate_split(tvec, tstep, states, options, statetype, degree, threshold, splitThreshold, maxSplitDepth, nullptr);
+    }
+
+    template<class T, template <class> class P>
+    std::vector<std::vector<std::vector<T>>> BasePropagatorPolynomial<T, P>::propagate(const std::vector<T> tvec, const T tstep, const std::vector<std::vector<T>> states, const PropagatorParameters<T> options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, const unsigned int maxSplitDepth, thames::propagators::flowmap::FlowMap<T>& map) {
         // Check that input is Cartesian state
         if(statetype != thames::constants::statetypes::CARTESIAN)
             throw std::runtime_error("Unsupported state type");
 
+        // Initialise flow map, or check consistency with existing domains
+        if(map.domains.empty()){
+            map.basis = thames::util::polynomials::polynomial_basis<P>();
+            map.nvar = states[0].size();
+            map.degree = degree;
+            map.threshold = threshold;
+            map.tvec = tvec;
+        } else if(map.basis != thames::util::polynomials::polynomial_basis<P>() || map.nvar != states[0].size() || map.degree != degree || map.threshold != threshold || map.tvec != tvec) {
+            throw std::runtime_error("Inconsistent flow map");
+        }
+
+        // Propagate states with domain splitting, appending domains to the flow map
+        return propagate_split(tvec, tstep, states, options, statetype, degree, threshold, splitThreshold, maxSplitDepth, &map.domains);
+    }
+
+    template<class T, template <class> class P>
+    std::vector<std::vector<std::vector<T>>> BasePropagatorPolynomial<T, P>::propagate_split(const std::vector<T>& tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T>& options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, const unsigned int maxSplitDepth, std::vector<thames::propagators::flowmap::FlowMapDomain<T>>* domains) {
+        // Declare output vectors
+        std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size(), std::vector<std::vector<T>>(states.size()));
+
+        // Append initial states to output
+        states_propagated[0] = states;
+
+        // Declare structure of a sub-domain awaiting propagation
+        struct SubDomain {
+            /// Index of the epoch from which the sub-domain is propagated
+            std::size_t start;
+            /// Indices of the states in the sub-domain
+            std::vector<std::size_t> indices;
+            /// Remaining number of splits
+            unsigned int depth;
+        };
+
+        // Declare root domain
+        std::vector<SubDomain> level(1, {0, std::vector<std::size_t>(states.size()), maxSplitDepth});
+        for(std::size_t ii=0; ii<states.size(); ii++)
+            level[0].indices[ii] = ii;
+
+        // Propagate each level of sub-domains, with the sub-domains of a level in parallel
+        while(!level.empty()){
+            // Declare sub-domains of the next level, and flow map domains of the completed sub-domains
+            std::vector<SubDomain> next;
+            std::mutex mutex;
+            std::vector<std::unique_ptr<thames::propagators::flowmap::FlowMapDomain<T>>> completed(level.size());
+
+            thames::util::threadpool::WorkStealingPool::shared().parallel_for(level.size(), [&](const std::size_t idomain){
+                // Extract times and states from the start of the sub-domain
+                const SubDomain& subdomain = level[idomain];
+                const std::vector<T> tvec_domain(tvec.begin() + subdomain.start, tvec.end());
+                std::vector<std::vector<T>> states_domain;
+                states_domain.reserve(subdomain.indices.size());
+                for(const std::size_t index : subdomain.indices)
+                    states_domain.push_back(states_propagated[subdomain.start][index]);
+
+                // Propagate, stopping at the epoch where the threshold is crossed if the sub-domain may be split further
+                const T splitThreshold_domain = (subdomain.depth > 0 && states_domain.size() > 1) ? splitThreshold : 0.0;
+                std::size_t crossing;
+                std::vector<T> scores;
+                thames::propagators::flowmap::FlowMapDomain<T> domain;
+                std::vector<std::vector<std::vector<T>>> states_domain_propagated = propagate_domain(tvec_domain, tstep, states_domain, options, statetype, degree, threshold, splitThreshold_domain, crossing, scores, (domains != nullptr) ? &domain : nullptr);
+
+                // Map states before the crossing back to their original positions
+                for(std::size_t jj=1; jj<crossing; jj++)
+                    for(std::size_t kk=0; kk<subdomain.indices.size(); kk++)
+                        states_propagated[subdomain.start + jj][subdomain.indices[kk]] = std::move(states_domain_propagated[jj][kk]);
+
+                // Store flow map domain if the sub-domain is complete
+                if(crossing == tvec_domain.size()){
+                    if(domains != nullptr)
+                        completed[idomain] = std::make_unique<thames::propagators::flowmap::FlowMapDomain<T>>(std::move(domain));
+                    return;
+                }
+
+                // Select variable with the largest contribution to the nonlinearity
+                const std::size_t isplit = std::distance(scores.begin(), std::max_element(scores.begin(), scores.end()));
+
+                // Calculate mid-point of the sub-domain along the selected variable
+                std::vector<T> lower, upper;
+                thames::conversions::polynomial::states_to_bounds(states_domain, lower, upper);
+                const T midpoint = (lower[isplit] + upper[isplit])/2.0;
+
+                // Partition states between the halves, which continue from the last epoch before the crossing
+                // NOTE: flow map domains map the initial states, so the halves are propagated from the first epoch when a flow map is stored
+                const std::size_t start = (domains != nullptr) ? 0 : subdomain.start + crossing - 1;
+                std::array<SubDomain, 2> halves = {SubDomain{start, {}, subdomain.depth - 1}, SubDomain{start, {}, subdomain.depth - 1}};
+                for(std::size_t kk=0; kk<states_domain.size(); kk++)
+                    halves[(states_domain[kk][isplit] <= midpoint) ? 0 : 1].indices.push_back(subdomain.indices[kk]);
+
+                // Queue halves, or continue the sub-domain without splitting if it cannot be divided further
+                std::lock_guard<std::mutex> lock(mutex);
+                if(halves[0].indices.empty() || halves[1].indices.empty()){
+                    next.push_back({subdomain.start, subdomain.indices, 0});
+                } else {
+                    next.push_back(std::move(halves[0]));
+                    next.push_back(std::move(halves[1]));
+                }
+            });
+
+            // Append flow map domains of the completed sub-domains
+            if(domains != nullptr){
+                for(std::unique_ptr<thames::propagators::flowmap::FlowMapDomain<T>>& domain : completed)
+                    if(domain)
+                        domains->push_back(std::move(*domain));
+            }
+
+            // Continue with the next level
+            level = std::move(next);
+        }
+
+        // Return propagated states
+        return states_propagated;
+    }
+
+    template<class T, template <class> class P>
+    std::vector<std::vector<std::vector<T>>> BasePropagatorPolynomial<T, P>::propagate_domain(const std::vector<T>& tvec, const T tstep, const std::vector<std::vector<T>>& states, const PropagatorParameters<T>& options, const StateTypes statetype, const unsigned int degree, const T threshold, const T splitThreshold, std::size_t& crossing, std::vector<T>& scores, thames::propagators::flowmap::FlowMapDomain<T>* domain) {
         // Declare output vectors
         std::vector<std::vector<std::vector<T>>> states_propagated(tvec.size());
 
         // Append initial states to output
         states_propagated[0] = states;
 
+        // Reset crossing and variable scores
+        crossing = tvec.size();
+        scores.assign(states[0].size(), 0.0);
+
+        // Lease multiplication table for the duration of the propagation
+        thames::util::polynomials::MultiplicationTableLease<T, P> lease(states[0].size(), degree);
+
         // Generate polynomials
-        std::vector<P<T>> statepolynomial, statepolynomial_temp;
+        std::vector<P<T>> statepolynomial;
         std::vector<T> lower, upper;
         thames::conversions::polynomial::states_to_polynomial(states, degree, statepolynomial, lower, upper);
 
         // Calculate sample points
         std::vector<std::vector<T>> samples = thames::conversions::polynomial::state_to_sample(states, lower, upper);
 
-        // Update factors
-        *m_factors = thames::conversions::dimensional::calculate_factors(statepolynomial, m_mu);
+        // Store bounds of the flow map domain
+        if(domain != nullptr){
+            domain->lower = lower;
+            domain->upper = upper;
+            domain->coefficients.assign(tvec.size() - 1, {});
+        }
 
-        // Convert to state polynomial to propagation state type
-        m_perturbation->set_nondimensional(false);
-        statepolynomial = thames::conversions::universal::convert_state<T, P>(tvec[0], statepolynomial, m_mu, statetype, m_propstatetype, m_perturbation);
+        // Declare times, factors, gravitational parameter and perturbation in the units of the propagation
+        std::vector<T> tvecprop(tvec);
+        T tstepprop = tstep;
+        DimensionalFactors<T> factors;
+        T mu = m_mu;
+        std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation = m_perturbation;
 
-        // Propagate state between times
-        for (std::size_t ii = 0; ii < tvec.size() - 1; ii++) {
-            // Update polynomials
-            statepolynomial = propagate(tvec[ii], tvec[ii+1], tstep, statepolynomial, options, m_propstatetype);
+        // Non-dimensionalise
+        if (options.isNonDimensional) {
+            // Time non-dimensionalisation
+            thames::util::profiling::ScopedTimer timer("nondimensionalise");
 
+            // Calculate factors
+            std::vector<P<T>> statepolynomial_cartesian = thames::conversions::universal::convert_state<T, P>(tvec[0], statepolynomial, m_mu, statetype, CARTESIAN, m_perturbation);
+            factors = thames::conversions::dimensional::calculate_factors(statepolynomial_cartesian, m_mu);
+
+            // Scale times
+            for (T& t : tvecprop)
+                t /= factors.time;
+            tstepprop /= factors.time;
+
+            // Scale state
+            statepolynomial = thames::conversions::universal::nondimensionalise_state(statepolynomial, statetype, factors);
+
+            // Scale gravitational parameter and perturbation
+            mu = m_mu/factors.grav;
+            perturbation = m_perturbation->nondimensionalise(factors);
+        }
+
+        // Create dynamics
+        const std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> dyn = create_dynamics(mu, perturbation);
+
+        // Convert to state polynomial to propagation state type
+        statepolynomial = thames::conversions::universal::convert_state<T, P>(tvecprop[0], statepolynomial, mu, statetype, m_propstatetype, perturbation);
+
+        // Declare function to convert the polynomials at an epoch to the state type, in physical units
+        auto convert_epoch = [&](const std::size_t ii, const std::vector<P<T>>& statepolynomial_epoch) {
+            std::vector<P<T>> statepolynomial_converted = thames::conversions::universal::convert_state<T, P>(tvecprop[ii], statepolynomial_epoch, mu, m_propstatetype, statetype, perturbation);
+            if (options.isNonDimensional) {
+                // Time re-dimensionalisation
+                thames::util::profiling::ScopedTimer timer("dimensionalise");
+
+                statepolynomial_converted = thames::conversions::universal::dimensionalise_state(statepolynomial_converted, statetype, factors);
+            }
+            return statepolynomial_converted;
+        };
+
+        // Declare flag set once an epoch crosses the splitting threshold, and mutex guarding the crossing and variable scores
+        std::atomic<bool> isCrossed(false);
+        std::mutex mutex;
+
+        // Declare function to convert, assess and sample the polynomials at an epoch
+        auto evaluate_epoch = [&](const std::size_t ii, const std::vector<P<T>>& statepolynomial_epoch) {
+            // Time evaluation
+            thames::util::profiling::ScopedTimer timer("evaluate_polynomials");
+
+            // NOTE: the lease of the propagating thread keeps the multiplication table resident until all evaluations complete
             // Copy and convert current polynomial
-            m_perturbation->set_nondimensional(false);
-            statepolynomial_temp = thames::conversions::universal::convert_state<T, P>(tvec[ii+1], statepolynomial, m_mu, m_propstatetype, statetype, m_perturbation);
+            const std::vector<P<T>> statepolynomial_temp = convert_epoch(ii, statepolynomial_epoch);
+
+            // Record the earliest epoch crossing the splitting threshold, and skip its evaluation
+            if (splitThreshold > 0.0) {
+                std::vector<T> scores_epoch;
+                if (thames::util::polynomials::nonlinearity_indicator(statepolynomial_temp, scores_epoch) > splitThreshold) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (ii < crossing) {
+                        crossing = ii;
+                        scores = scores_epoch;
+                    }
+                    isCrossed = true;
+                    return;
+                }
+            }
+
+            // Store coefficients in the flow map domain
+            if(domain != nullptr){
+                for(const P<T>& polynomial : statepolynomial_temp)
+                    domain->coefficients[ii-1].push_back(polynomial.get_coeffs());
+            }
 
             // Sample polynomials and store
-            states_propagated[ii+1] = thames::util::polynomials::evaluate_polynomials(statepolynomial_temp, samples);
+            states_propagated[ii] = thames::util::polynomials::evaluate_polynomials(statepolynomial_temp, samples, threshold);
+        };
+
+        // Create pool for evaluation alongside integration, if enabled
+        std::unique_ptr<thames::util::threadpool::WorkStealingPool> pool;
+        if (options.evaluationThreads > 0)
+            pool = std::make_unique<thames::util::threadpool::WorkStealingPool>(options.evaluationThreads);
+
+        // Propagate state between times, stopping once an evaluated epoch crosses the splitting threshold
+        // NOTE: with the pool, integration continues speculatively whilst earlier epochs are assessed, and epochs after the crossing are discarded
+        for (std::size_t ii = 0; ii < tvec.size() - 1 && !isCrossed; ii++) {
+            // Update polynomials, keeping them in the units and coordinates of the propagation
+            integrate_interval<T, P>(dyn, statepolynomial, tvecprop[ii], tvecprop[ii+1], tstepprop, options);
+
+            // Evaluate epoch in the pool whilst integration continues, or in turn
+            if (pool) {
+                pool->submit([&evaluate_epoch, ii, statepolynomial]() {evaluate_epoch(ii+1, statepolynomial);});
+            } else {
+                evaluate_epoch(ii+1, statepolynomial);
+            }
         }
 
+        // Wait for outstanding evaluations
+        if (pool)
+            pool->wait();
+
         // Return propagated states
         return states_propagated;        
     }
@@ -22,6 +22,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <memory>
@@ -40,6 +41,7 @@ SOFTWARE.
 #include "../../include/propagators/basepropagator.h"
 #include "../../include/propagators/cowell.h"
 #include "../../include/perturbations/baseperturbation.h"
+#include "../../include/util/powers.h"
 #include "../../include/vector/arithmeticoverloads.h"
 #include "../../include/vector/geometry.h"
 
@@ -49,21 +51,19 @@ namespace thames::propagators {
     using thames::perturbations::baseperturbation::BasePerturbation;
     using namespace thames::vector::arithmeticoverloads;
     using thames::conversions::dimensional::DimensionalFactors;
+    using thames::util::powers::ipow;
 
     ///////////
     // Reals //
     ///////////
 
     template<class T>
-    CowellPropagator<T>::CowellPropagator(const T& mu, const std::shared_ptr<BasePerturbation<T>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors) : BasePropagator<T>(mu, perturbation, factors, CARTESIAN) {
+    CowellPropagator<T>::CowellPropagator(const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation) : BasePropagator<T>(mu, perturbation, CARTESIAN) {
 
     }
 
     template<class T>
-    void CowellPropagator<T>::derivative(const std::vector<T>& RV, std::vector<T>& RVdot, const T t) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
-
+    void CowellPropagator<T>::derivative(const std::vector<T>& RV, std::vector<T>& RVdot, const T t, const T mu, const BasePerturbation<T>& perturbation) const {
         // Extract Cartesian state vectors
         std::vector<T> R = {RV[0], RV[1], RV[2]};
         std::vector<T> V = {RV[3], RV[4], RV[5]};
@@ -72,10 +72,10 @@ namespace thames::propagators {
         T r = thames::vector::geometry::norm3(R);
 
         // Calculate perturbing acceleration
-        std::vector<T> F = m_perturbation->acceleration_total(t, R, V);
+        std::vector<T> F = perturbation.acceleration_total(t, R, V);
 
         // Calculate central body acceleration
-        std::vector<T> G = -mu/pow(r, 3.0)*R;
+        std::vector<T> G = -mu/ipow<3>(r)*R;
 
         // Calculate acceleration
         std::vector<T> A = G + F;
@@ -87,7 +87,92 @@ namespace thames::propagators {
         }
     }
 
+    template<class T>
+    void CowellPropagator<T>::derivative_ensemble(const std::vector<T>& RV, std::vector<T>& RVdot, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const {
+        // Calculate perturbing accelerations
+        std::vector<T> F(3*n, 0.0);
+        perturbation.acceleration_total_ensemble(t, RV, F, n);
+
+        // Extract Cartesian state components
+        const T* x = RV.data();
+        const T* y = x + n;
+        const T* z = y + n;
+        const T* v = z + n;
+
+        // Calculate velocities
+        std::copy(v, v + 3*n, RVdot.begin());
+
+        // Calculate accelerations
+        T* ax = RVdot.data() + 3*n;
+        T* ay = ax + n;
+        T* az = ay + n;
+        for (std::size_t ii = 0; ii < n; ii++) {
+            const T r2 = x[ii]*x[ii] + y[ii]*y[ii] + z[ii]*z[ii];
+            const T fac = -mu/(r2*std::sqrt(r2));
+            ax[ii] = fac*x[ii] + F[ii];
+            ay[ii] = fac*y[ii] + F[n + ii];
+            az[ii] = fac*z[ii] + F[2*n + ii];
+        }
+    }
+
+    template<class T>
+    void CowellPropagator<T>::derivative_deviations(const std::vector<T>& RV, const std::vector<T>& RVdot, const std::vector<float>& dRV, std::vector<float>& dRVdot, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const {
+        // Calculate nominal range and perturbation Jacobian
+        const std::vector<T> R = {RV[0], RV[1], RV[2]};
+        const std::vector<T> V = {RV[3], RV[4], RV[5]};
+        const T r2 = R[0]*R[0] + R[1]*R[1] + R[2]*R[2];
+        const std::vector<T> J = perturbation.jacobian(t, R, V);
+
+        // Cast nominal quantities to single precision
+        const float x0 = (float) R[0], y0 = (float) R[1], z0 = (float) R[2];
+        const float r02 = (float) r2;
+        const float fac = (float) (-mu/(r2*std::sqrt(r2)));
+        std::array<float, 18> Jf;
+        for (std::size_t ii = 0; ii < 18; ii++)
+            Jf[ii] = (float) J[ii];
+
+        // Extract Cartesian deviation components
+        const float* dx = dRV.data();
+        const float* dy = dx + n;
+        const float* dz = dy + n;
+        const float* dvx = dz + n;
+        const float* dvy = dvx + n;
+        const float* dvz = dvy + n;
+
+        // Calculate velocity deviations
+        std::copy(dvx, dvx + 3*n, dRVdot.begin());
+
+        // Calculate acceleration deviations
+        // NOTE: (1 + q)^(-3/2) - 1 is evaluated without cancellation, as -((1 + q)^(3/2) - 1)/(1 + q)^(3/2) with (1 + q)^(3/2) - 1 = q(3 + 3q + q^2)/(1 + (1 + q)^(3/2))
+        float* dax = dRVdot.data() + 3*n;
+        float* day = dax + n;
+        float* daz = day + n;
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Calculate member position
+            const float x = x0 + dx[ii], y = y0 + dy[ii], z = z0 + dz[ii];
+
+            // Calculate Encke's correction to the central body acceleration
+            const float q = (dx[ii]*(x0 + x) + dy[ii]*(y0 + y) + dz[ii]*(z0 + z))/r02;
+            const float p = (1.0f + q)*std::sqrt(1.0f + q);
+            const float f = -q*(3.0f + q*(3.0f + q))/((1.0f + p)*p);
+
+            // Calculate linearised perturbing acceleration deviations
+            const float dF[3] = {
+                Jf[0]*dx[ii] + Jf[1]*dy[ii] + Jf[2]*dz[ii] + Jf[3]*dvx[ii] + Jf[4]*dvy[ii] + Jf[5]*dvz[ii],
+                Jf[6]*dx[ii] + Jf[7]*dy[ii] + Jf[8]*dz[ii] + Jf[9]*dvx[ii] + Jf[10]*dvy[ii] + Jf[11]*dvz[ii],
+                Jf[12]*dx[ii] + Jf[13]*dy[ii] + Jf[14]*dz[ii] + Jf[15]*dvx[ii] + Jf[16]*dvy[ii] + Jf[17]*dvz[ii]
+            };
+
+            // Calculate acceleration deviations
+            dax[ii] = fac*(dx[ii] + f*x) + dF[0];
+            day[ii] = fac*(dy[ii] + f*y) + dF[1];
+            daz[ii] = fac*(dz[ii] + f*z) + dF[2];
+        }
+    }
+
     template class CowellPropagator<double>;
+    template class CowellPropagator<float>;
+    template class CowellPropagator<long double>;
 
     /////////////////
     // Polynomials //
@@ -102,7 +187,7 @@ namespace thames::propagators {
     using thames::propagators::basepropagator::BasePropagatorPolynomialDynamics;
 
     template<class T, template<class> class P>
-    CowellPropagatorPolynomialDynamics<T, P>::CowellPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePropagatorPolynomialDynamics<T, P>("Cowell", mu, perturbation, factors) {
+    CowellPropagatorPolynomialDynamics<T, P>::CowellPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) : BasePropagatorPolynomialDynamics<T, P>("Cowell", mu, perturbation) {
 
     }
 
@@ -113,8 +198,8 @@ namespace thames::propagators {
 
     template<class T, template<class> class P>
     int CowellPropagatorPolynomialDynamics<T, P>::evaluate(const T& t, const std::vector<P<T>>& RV, std::vector<P<T>>& RVdot) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
+        // Extract gravitational parameter
+        const T mu = m_mu;
 
         // Extract Cartesian state vectors
         std::vector<P<T>> R = {RV[0], RV[1], RV[2]};
@@ -127,7 +212,7 @@ namespace thames::propagators {
         std::vector<P<T>> F = m_perturbation->acceleration_total(t, R, V);
 
         // Calculate central body acceleration
-        std::vector<P<T>> G = -mu/pow(r, 3)*R;
+        std::vector<P<T>> G = -mu/ipow<3>(r)*R;
 
         // Calculate acceleration
         std::vector<P<T>> A = G + F;
@@ -143,7 +228,7 @@ namespace thames::propagators {
     template class CowellPropagatorPolynomialDynamics<double, chebyshev_polynomial>;
 
     template<class T, template<class> class P>
-    CowellPropagatorPolynomial<T, P>::CowellPropagatorPolynomial(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors) : BasePropagatorPolynomial<T, P>(mu, perturbation, factors, std::make_shared<CowellPropagatorPolynomialDynamics<T, P>>(mu, perturbation, factors), CARTESIAN) {
+    CowellPropagatorPolynomial<T, P>::CowellPropagatorPolynomial(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) : BasePropagatorPolynomial<T, P>(mu, perturbation, CARTESIAN) {
 
     }
 
@@ -152,6 +237,11 @@ namespace thames::propagators {
         
     }
 
+    template<class T, template<class> class P>
+    std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> CowellPropagatorPolynomial<T, P>::create_dynamics(const T mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) const {
+        return std::make_shared<CowellPropagatorPolynomialDynamics<T, P>>(mu, perturbation);
+    }
+
     template class CowellPropagatorPolynomial<double, taylor_polynomial>;
     template class CowellPropagatorPolynomial<double, chebyshev_polynomial>;
 
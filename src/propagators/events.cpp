@@ -0,0 +1,152 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "../../include/propagators/events.h"
+#include "../../include/vector/arithmeticoverloads.h"
+#include "../../include/vector/geometry.h"
+
+namespace thames::propagators::events {
+
+    using namespace thames::vector::arithmeticoverloads;
+
+    ///////////
+    // Reals //
+    ///////////
+
+    template<class T>
+    BaseEvent<T>::BaseEvent(const bool isTerminal, const int direction) : m_isTerminal(isTerminal), m_direction(direction) {
+
+    }
+
+    template<class T>
+    BaseEvent<T>::~BaseEvent() {
+
+    }
+
+    template<class T>
+    T BaseEvent<T>::value(const T& t, const std::vector<T>& RV) const {
+        // Throw error if event function is not implemented in derived events
+        throw std::runtime_error("Event function must be defined");
+    }
+
+    template<class T>
+    bool BaseEvent<T>::is_terminal() const {
+        return m_isTerminal;
+    }
+
+    template<class T>
+    int BaseEvent<T>::get_direction() const {
+        return m_direction;
+    }
+
+    template class BaseEvent<double>;
+    template class BaseEvent<float>;
+    template class BaseEvent<long double>;
+
+    template<class T>
+    AltitudeEvent<T>::AltitudeEvent(const T& radius, const T& altitude, const bool isTerminal, const int direction) : BaseEvent<T>(isTerminal, direction), m_radius(radius), m_altitude(altitude) {
+
+    }
+
+    template<class T>
+    AltitudeEvent<T>::~AltitudeEvent() {
+
+    }
+
+    template<class T>
+    T AltitudeEvent<T>::value(const T& t, const std::vector<T>& RV) const {
+        // Extract position
+        const std::vector<T> R(RV.begin(), RV.begin() + 3);
+
+        // Return altitude above the reference altitude
+        return thames::vector::geometry::norm3(R) - m_radius - m_altitude;
+    }
+
+    template class AltitudeEvent<double>;
+    template class AltitudeEvent<float>;
+    template class AltitudeEvent<long double>;
+
+    template<class T>
+    NodeEvent<T>::NodeEvent(const bool isTerminal, const int direction) : BaseEvent<T>(isTerminal, direction) {
+
+    }
+
+    template<class T>
+    NodeEvent<T>::~NodeEvent() {
+
+    }
+
+    template<class T>
+    T NodeEvent<T>::value(const T& t, const std::vector<T>& RV) const {
+        // Return out-of-plane position
+        return RV[2];
+    }
+
+    template class NodeEvent<double>;
+    template class NodeEvent<float>;
+    template class NodeEvent<long double>;
+
+    template<class T>
+    EclipseEvent<T>::EclipseEvent(const T& radius, const std::vector<T>& sunDirection, const bool isTerminal, const int direction) : BaseEvent<T>(isTerminal, direction), m_radius(radius) {
+        // Check Sun direction
+        if (sunDirection.size() != 3)
+            throw std::runtime_error("Sun direction must have three components");
+        const T norm = thames::vector::geometry::norm3(sunDirection);
+        if (norm == 0.0)
+            throw std::runtime_error("Sun direction must be non-zero");
+
+        // Store unit vector towards the Sun
+        m_sunDirection = sunDirection/norm;
+    }
+
+    template<class T>
+    EclipseEvent<T>::~EclipseEvent() {
+
+    }
+
+    template<class T>
+    T EclipseEvent<T>::value(const T& t, const std::vector<T>& RV) const {
+        // Extract position
+        const std::vector<T> R(RV.begin(), RV.begin() + 3);
+
+        // Calculate position along the Sun direction
+        const T s = thames::vector::geometry::dot3(R, m_sunDirection);
+
+        // Return altitude on the sunlit side
+        if (s >= 0.0)
+            return thames::vector::geometry::norm3(R) - m_radius;
+
+        // Return distance from the edge of the shadow cylinder
+        return thames::vector::geometry::norm3(R - s*m_sunDirection) - m_radius;
+    }
+
+    template class EclipseEvent<double>;
+    template class EclipseEvent<float>;
+    template class EclipseEvent<long double>;
+
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../../include/conversions/polynomial.h"
+#include "../../include/propagators/flowmap.h"
+#include "../../include/util/polynomials.h"
+#include "../../include/util/profiling.h"
+
+namespace thames::propagators::flowmap {
+
+    template<class T>
+    std::size_t select_domain(const FlowMap<T>& map, const std::vector<T>& state, T& excess) {
+        // Check that the flow map has domains
+        if(map.domains.empty())
+            throw std::runtime_error("Flow map has no domains");
+
+        // Find domain with the smallest excess
+        std::size_t iselected = 0;
+        excess = std::numeric_limits<T>::infinity();
+        for(std::size_t ii=0; ii<map.domains.size(); ii++){
+            // Calculate largest excess of the state variables beyond the domain
+            const FlowMapDomain<T>& domain = map.domains[ii];
+            T excess_domain = 0.0;
+            for(std::size_t jj=0; jj<state.size(); jj++){
+                // Calculate excess in scaled variables, or treat any offset as unbounded when the domain has zero range
+                T excess_variable;
+                if((domain.upper[jj] - domain.lower[jj]) == 0.0){
+                    excess_variable = (state[jj] == domain.lower[jj]) ? 0.0 : std::numeric_limits<T>::infinity();
+                } else {
+                    const T sample = 2.0*(state[jj] - domain.lower[jj])/(domain.upper[jj] - domain.lower[jj]) - 1.0;
+                    excess_variable = std::max(std::abs(sample) - 1.0, 0.0);
+                }
+                excess_domain = std::max(excess_domain, excess_variable);
+            }
+
+            // Update selected domain
+            if(excess_domain < excess){
+                excess = excess_domain;
+                iselected = ii;
+            }
+
+            // Stop at the first containing domain
+            if(excess == 0.0)
+                break;
+        }
+
+        // Return selected domain
+        return iselected;
+    }
+    template std::size_t select_domain(const FlowMap<double>&, const std::vector<double>&, double&);
+
+    template<class T>
+    std::vector<std::vector<std::vector<T>>> evaluate(const FlowMap<T>& map, const std::vector<std::vector<T>>& states, const T margin) {
+        // Time evaluation
+        thames::util::profiling::ScopedTimer timer("evaluate_flowmap");
+
+        // Check flow map dimensions
+        const thames::util::polynomials::MonomialTable& table = thames::util::polynomials::monomial_table(map.nvar, map.degree);
+        for(const FlowMapDomain<T>& domain : map.domains){
+            if(domain.lower.size() != map.nvar || domain.upper.size() != map.nvar || domain.coefficients.size() + 1 != map.tvec.size())
+                throw std::runtime_error("Inconsistent flow map domain");
+            for(const std::vector<std::vector<T>>& coefficients : domain.coefficients)
+                for(const std::vector<T>& coefficient : coefficients)
+                    if(coefficient.size() != table.nterms)
+                        throw std::runtime_error("Inconsistent flow map coefficients");
+        }
+
+        // Declare output vectors
+        std::vector<std::vector<std::vector<T>>> states_evaluated(map.tvec.size(), std::vector<std::vector<T>>(states.size()));
+
+        // Append initial states to output
+        states_evaluated[0] = states;
+
+        // Assign states to domains
+        std::vector<std::vector<std::size_t>> indices(map.domains.size());
+        for(std::size_t ii=0; ii<states.size(); ii++){
+            // Check state dimension
+            if(states[ii].size() != map.nvar)
+                throw std::runtime_error("Inconsistent state dimension for flow map");
+
+            // Select domain, and check excess
+            T excess;
+            const std::size_t idomain = select_domain(map, states[ii], excess);
+            if(excess > margin)
+                throw std::runtime_error("State outside of flow map domains");
+            indices[idomain].push_back(ii);
+        }
+
+        // Evaluate each domain
+        for(std::size_t ii=0; ii<map.domains.size(); ii++){
+            // Skip domains without states
+            if(indices[ii].empty())
+                continue;
+
+            // Calculate sample points
+            const FlowMapDomain<T>& domain = map.domains[ii];
+            std::vector<std::vector<T>> samples;
+            samples.reserve(indices[ii].size());
+            for(const std::size_t index : indices[ii])
+                samples.push_back(thames::conversions::polynomial::state_to_sample(states[index], domain.lower, domain.upper));
+
+            // Evaluate polynomials at each epoch, and map states back to their original positions
+            for(std::size_t jj=0; jj<domain.coefficients.size(); jj++){
+                const thames::util::polynomials::SparsePolynomials<T> polynomials = thames::util::polynomials::sparse_polynomials(domain.coefficients[jj], table, map.basis, map.threshold);
+                std::vector<std::vector<T>> states_domain = thames::util::polynomials::evaluate_sparse(polynomials, samples);
+                for(std::size_t kk=0; kk<indices[ii].size(); kk++)
+                    states_evaluated[jj+1][indices[ii][kk]] = std::move(states_domain[kk]);
+            }
+        }
+
+        // Return evaluated states
+        return states_evaluated;
+    }
+    template std::vector<std::vector<std::vector<double>>> evaluate(const FlowMap<double>&, const std::vector<std::vector<double>>&, const double);
+
+}
\ No newline at end of file
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "../../include/propagators/geqoe.h"
 #include "../../include/conversions/geqoe.h"
 #include "../../include/perturbations/baseperturbation.h"
+#include "../../include/util/powers.h"
 #include "../../include/util/root.h"
 #include "../../include/vector/arithmeticoverloads.h"
 #include "../../include/vector/geometry.h"
@@ -47,21 +48,20 @@ namespace thames::propagators {
     using thames::constants::statetypes::GEQOE;
     using thames::perturbations::baseperturbation::BasePerturbation;
     using namespace thames::vector::arithmeticoverloads;
+    using thames::util::powers::cbrt;
+    using thames::util::powers::ipow;
 
     ///////////
     // Reals //
     ///////////
 
     template<class T>
-    GEqOEPropagator<T>::GEqOEPropagator(const T& mu, const std::shared_ptr<BasePerturbation<T>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors) : BasePropagator<T>(mu, perturbation, factors, GEQOE) {
+    GEqOEPropagator<T>::GEqOEPropagator(const T& mu, const std::shared_ptr<const BasePerturbation<T>> perturbation) : BasePropagator<T>(mu, perturbation, GEQOE) {
 
     }
 
     template<class T>
-    void GEqOEPropagator<T>::derivative(const std::vector<T>& geqoe, std::vector<T>& geqoedot, const T t) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
-
+    void GEqOEPropagator<T>::derivative(const std::vector<T>& geqoe, std::vector<T>& geqoedot, const T t, const T mu, const BasePerturbation<T>& perturbation) const {
         // Extract elements
         T nu = geqoe[0];
         T p1 = geqoe[1];
@@ -78,28 +78,30 @@ namespace thames::propagators {
         T cosk = cos(k);
 
         // Calculate generalised semi-major axis
-        T a = pow(mu/pow(nu, 2.0), 1.0/3.0);
+        T a = cbrt(mu/ipow<2>(nu));
+        T sqrtmua = sqrt(mu*a);
 
         // Calculate range and range rate
         T r = a*(1.0 - p1*sink - p2*cosk);
-        T drdt = sqrt(mu*a)/r*(p2*sink - p1*cosk);
+        T drdt = sqrtmua/r*(p2*sink - p1*cosk);
 
         // Calculate trig of the true longitude
-        T alpha = 1.0/(1.0 + sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0)));
-        T sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*pow(p2, 2.0))*sink - p1);
-        T cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*pow(p1, 2.0))*cosk - p2);
+        T beta = sqrt(1.0 - ipow<2>(p1) - ipow<2>(p2));
+        T alpha = 1.0/(1.0 + beta);
+        T sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*ipow<2>(p2))*sink - p1);
+        T cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*ipow<2>(p1))*cosk - p2);
 
         // Calculate equinocital reference frame unit vectors
-        T efac = 1.0/(1.0 + pow(q1, 2.0) + pow(q2, 2.0));
+        T efac = 1.0/(1.0 + ipow<2>(q1) + ipow<2>(q2));
         std::vector<T> ex = {
-            efac*(1.0 - pow(q1, 2.0) + pow(q2, 2.0)),
-            efac*(2.0*q1*q2),
-            efac*(-2.0*q1)
+            T(efac*(1.0 - ipow<2>(q1) + ipow<2>(q2))),
+            T(efac*(2.0*q1*q2)),
+            T(efac*(-2.0*q1))
         };
         std::vector<T> ey = {
-            efac*(2.0*q1*q2),
-            efac*(1.0 + pow(q1, 2.0) - pow(q2, 2.0)),
-            efac*(2.0*q2)
+            T(efac*(2.0*q1*q2)),
+            T(efac*(1.0 + ipow<2>(q1) - ipow<2>(q2))),
+            T(efac*(2.0*q2))
         };
 
         // Calculate orbital basis vectors
@@ -110,25 +112,25 @@ namespace thames::propagators {
         std::vector<T> R = r*er;
 
         // Calculate generalised angular momentum
-        T c = pow(pow(mu, 2.0)/nu, 1.0/3.0)*sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0));
+        T c = sqrtmua*beta;
 
         // Calculate angular momentum
-        T h = sqrt(pow(c, 2.0) - 2.0*pow(r, 2.0)*m_perturbation->potential(t, R));
+        T h = sqrt(ipow<2>(c) - 2.0*ipow<2>(r)*perturbation.potential(t, R));
 
         // Calculate velocity
         std::vector<T> V = drdt*er + h/r*ef;
 
         // Calculate perturbations
-        T U = m_perturbation->potential(t, R);
-        T Ut = m_perturbation->potential_derivative(t, R, V);
-        std::vector<T> F = m_perturbation->acceleration_total(t, R, V);
-        std::vector<T> P = m_perturbation->acceleration_nonpotential(t, R, V);
+        T U = perturbation.potential(t, R);
+        T Ut = perturbation.potential_derivative(t, R, V);
+        std::vector<T> F = perturbation.acceleration_total(t, R, V);
+        std::vector<T> P = perturbation.acceleration_nonpotential(t, R, V);
 
         // Calculate time derivative of total energy
         T edot = Ut + thames::vector::geometry::dot3(P, V);
 
         // Calculate time derivative of nu
-        T nudot = -3.0*pow(nu/pow(mu, 2.0), 1.0/3.0)*edot;
+        T nudot = -3.0/sqrtmua*edot;
 
         // Calculate trig of the true longitude
         T cl = thames::vector::geometry::dot3(er, ex);
@@ -142,7 +144,7 @@ namespace thames::propagators {
         std::vector<T> eh = H/h;
 
         // Calculate the generalised semi-latus rectum
-        T p = pow(c, 2.0)/mu;
+        T p = ipow<2>(c)/mu;
 
         // Calculate perturbation components
         T Fr = thames::vector::geometry::dot3(F, er);
@@ -153,15 +155,15 @@ namespace thames::propagators {
         T zetatilde = 1 + zeta;
 
         // Calculate time derivatives of the second and third elements
-        T p1dot = p2*((h - c)/pow(r, 2.0) - r/h*hwh*Fh) + 1.0/c*(r*drdt/c*p1 + zetatilde*p2 + zeta*cl)*(2.0*U - r*Fr) + r/mu*(zeta*p1 + zetatilde*sl)*edot;
-        T p2dot = p1*(r/h*hwh*Fh - (h-c)/pow(r, 2.0)) + 1.0/c*(r*drdt/c*p2 - zetatilde*p1 - zeta*sl)*(2.0*U - r*Fr) + r/mu*(zeta*p2 + zetatilde*cl)*edot;
+        T p1dot = p2*((h - c)/ipow<2>(r) - r/h*hwh*Fh) + 1.0/c*(r*drdt/c*p1 + zetatilde*p2 + zeta*cl)*(2.0*U - r*Fr) + r/mu*(zeta*p1 + zetatilde*sl)*edot;
+        T p2dot = p1*(r/h*hwh*Fh - (h-c)/ipow<2>(r)) + 1.0/c*(r*drdt/c*p2 - zetatilde*p1 - zeta*sl)*(2.0*U - r*Fr) + r/mu*(zeta*p2 + zetatilde*cl)*edot;
 
         // Calculate time derivative of the generalised mean longitude
-        T Ldot = nu + (h - c)/pow(r, 2.0) - r/h*hwh*Fh + (r*drdt*c/pow(mu, 2.0)*zetatilde*alpha)*edot + 1.0/c*(1.0/alpha + alpha*(1.0 - r/a))*(2.0*U - r*Fr);
+        T Ldot = nu + (h - c)/ipow<2>(r) - r/h*hwh*Fh + (r*drdt*c/ipow<2>(mu)*zetatilde*alpha)*edot + 1.0/c*(1.0/alpha + alpha*(1.0 - r/a))*(2.0*U - r*Fr);
 
         // Calculate time derivatives of the remaining elements
-        T q1dot = r/(2.0*h)*Fh*(1.0 + pow(q1, 2.0) + pow(q2, 2.0))*sl;
-        T q2dot = r/(2.0*h)*Fh*(1.0 + pow(q1, 2.0) + pow(q2, 2.0))*cl;
+        T q1dot = r/(2.0*h)*Fh*(1.0 + ipow<2>(q1) + ipow<2>(q2))*sl;
+        T q2dot = r/(2.0*h)*Fh*(1.0 + ipow<2>(q1) + ipow<2>(q2))*cl;
 
         // Store derivatives
         geqoedot = {
@@ -174,7 +176,136 @@ namespace thames::propagators {
         };
     }
 
+    template<class T>
+    void GEqOEPropagator<T>::derivative_ensemble(const std::vector<T>& geqoe, std::vector<T>& geqoedot, const T t, const std::size_t n, const T mu, const BasePerturbation<T>& perturbation) const {
+        // Extract elements
+        const T* nu = geqoe.data();
+        const T* p1 = nu + n;
+        const T* p2 = p1 + n;
+        const T* L = p2 + n;
+        const T* q1 = L + n;
+        const T* q2 = q1 + n;
+
+        // Declare Cartesian states, and intermediate quantities of each member
+        std::vector<T> RV(6*n, 0.0);
+        std::vector<T> a(n), sqrtmua(n), r(n), drdt(n), alpha(n), c(n);
+        std::vector<T> ex(3*n), ey(3*n), er(3*n), ef(3*n);
+
+        // Calculate positions
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Calculate generalised eccentric longitude
+            const T p1i = p1[ii], p2i = p2[ii], Li = L[ii];
+            std::function<T (T)> fk = [p1i, p2i, Li](T k) {return (k + p1i*cos(k) - p2i*sin(k) - Li);};
+            std::function<T (T)> dfk = [p1i, p2i](T k) {return (1 - p1i*sin(k) - p2i*cos(k));};
+            const T k = thames::util::root::newton_raphson(fk, dfk, Li);
+            const T sink = sin(k);
+            const T cosk = cos(k);
+
+            // Calculate generalised semi-major axis
+            a[ii] = cbrt(mu/ipow<2>(nu[ii]));
+            sqrtmua[ii] = sqrt(mu*a[ii]);
+
+            // Calculate range and range rate
+            r[ii] = a[ii]*(1.0 - p1i*sink - p2i*cosk);
+            drdt[ii] = sqrtmua[ii]/r[ii]*(p2i*sink - p1i*cosk);
+
+            // Calculate trig of the true longitude
+            const T beta = sqrt(1.0 - ipow<2>(p1i) - ipow<2>(p2i));
+            alpha[ii] = 1.0/(1.0 + beta);
+            const T sinl = a[ii]/r[ii]*(alpha[ii]*p1i*p2i*cosk + (1.0 - alpha[ii]*ipow<2>(p2i))*sink - p1i);
+            const T cosl = a[ii]/r[ii]*(alpha[ii]*p1i*p2i*sink + (1.0 - alpha[ii]*ipow<2>(p1i))*cosk - p2i);
+
+            // Calculate equinoctial reference frame unit vectors
+            const T q1i = q1[ii], q2i = q2[ii];
+            const T efac = 1.0/(1.0 + ipow<2>(q1i) + ipow<2>(q2i));
+            ex[ii] = efac*(1.0 - ipow<2>(q1i) + ipow<2>(q2i));
+            ex[n + ii] = efac*(2.0*q1i*q2i);
+            ex[2*n + ii] = efac*(-2.0*q1i);
+            ey[ii] = efac*(2.0*q1i*q2i);
+            ey[n + ii] = efac*(1.0 + ipow<2>(q1i) - ipow<2>(q2i));
+            ey[2*n + ii] = efac*(2.0*q2i);
+
+            // Calculate orbital basis vectors, and position
+            for (std::size_t jj = 0; jj < 3; jj++) {
+                er[jj*n + ii] = ex[jj*n + ii]*cosl + ey[jj*n + ii]*sinl;
+                ef[jj*n + ii] = ey[jj*n + ii]*cosl - ex[jj*n + ii]*sinl;
+                RV[jj*n + ii] = r[ii]*er[jj*n + ii];
+            }
+
+            // Calculate generalised angular momentum
+            c[ii] = sqrtmua[ii]*beta;
+        }
+
+        // Calculate perturbing potentials
+        std::vector<T> U(n, 0.0);
+        perturbation.potential_ensemble(t, RV, U, n);
+
+        // Calculate angular momenta and velocities
+        std::vector<T> h(n);
+        for (std::size_t ii = 0; ii < n; ii++) {
+            h[ii] = sqrt(ipow<2>(c[ii]) - 2.0*ipow<2>(r[ii])*U[ii]);
+            for (std::size_t jj = 0; jj < 3; jj++)
+                RV[(jj + 3)*n + ii] = drdt[ii]*er[jj*n + ii] + h[ii]/r[ii]*ef[jj*n + ii];
+        }
+
+        // Calculate perturbations
+        std::vector<T> Ut(n, 0.0), F(3*n, 0.0), P(3*n, 0.0);
+        perturbation.potential_derivative_ensemble(t, RV, Ut, n);
+        perturbation.acceleration_total_ensemble(t, RV, F, n);
+        perturbation.acceleration_nonpotential_ensemble(t, RV, P, n);
+
+        // Calculate element derivatives
+        T* nudot = geqoedot.data();
+        T* p1dot = nudot + n;
+        T* p2dot = p1dot + n;
+        T* Ldot = p2dot + n;
+        T* q1dot = Ldot + n;
+        T* q2dot = q1dot + n;
+        for (std::size_t ii = 0; ii < n; ii++) {
+            // Extract Cartesian state
+            const T x = RV[ii], y = RV[n + ii], z = RV[2*n + ii];
+            const T vx = RV[3*n + ii], vy = RV[4*n + ii], vz = RV[5*n + ii];
+
+            // Calculate time derivative of total energy
+            const T edot = Ut[ii] + P[ii]*vx + P[n + ii]*vy + P[2*n + ii]*vz;
+
+            // Calculate trig of the true longitude
+            const T cl = er[ii]*ex[ii] + er[n + ii]*ex[n + ii] + er[2*n + ii]*ex[2*n + ii];
+            const T sl = er[ii]*ey[ii] + er[n + ii]*ey[n + ii] + er[2*n + ii]*ey[2*n + ii];
+
+            // Calculate equinoctial reference frame velocity components
+            const T hwh = q1[ii]*cl - q2[ii]*sl;
+
+            // Calculate angular momentum unit vector
+            const T ehx = (y*vz - z*vy)/h[ii];
+            const T ehy = (z*vx - x*vz)/h[ii];
+            const T ehz = (x*vy - y*vx)/h[ii];
+
+            // Calculate the generalised semi-latus rectum
+            const T p = ipow<2>(c[ii])/mu;
+
+            // Calculate perturbation components
+            const T Fr = F[ii]*er[ii] + F[n + ii]*er[n + ii] + F[2*n + ii]*er[2*n + ii];
+            const T Fh = F[ii]*ehx + F[n + ii]*ehy + F[2*n + ii]*ehz;
+
+            // Calculate non-dimensional quantities
+            const T ri = r[ii], hi = h[ii], ci = c[ii];
+            const T zeta = ri/p;
+            const T zetatilde = 1 + zeta;
+
+            // Calculate time derivatives
+            nudot[ii] = -3.0/sqrtmua[ii]*edot;
+            p1dot[ii] = p2[ii]*((hi - ci)/ipow<2>(ri) - ri/hi*hwh*Fh) + 1.0/ci*(ri*drdt[ii]/ci*p1[ii] + zetatilde*p2[ii] + zeta*cl)*(2.0*U[ii] - ri*Fr) + ri/mu*(zeta*p1[ii] + zetatilde*sl)*edot;
+            p2dot[ii] = p1[ii]*(ri/hi*hwh*Fh - (hi - ci)/ipow<2>(ri)) + 1.0/ci*(ri*drdt[ii]/ci*p2[ii] - zetatilde*p1[ii] - zeta*sl)*(2.0*U[ii] - ri*Fr) + ri/mu*(zeta*p2[ii] + zetatilde*cl)*edot;
+            Ldot[ii] = nu[ii] + (hi - ci)/ipow<2>(ri) - ri/hi*hwh*Fh + (ri*drdt[ii]*ci/ipow<2>(mu)*zetatilde*alpha[ii])*edot + 1.0/ci*(1.0/alpha[ii] + alpha[ii]*(1.0 - ri/a[ii]))*(2.0*U[ii] - ri*Fr);
+            q1dot[ii] = ri/(2.0*hi)*Fh*(1.0 + ipow<2>(q1[ii]) + ipow<2>(q2[ii]))*sl;
+            q2dot[ii] = ri/(2.0*hi)*Fh*(1.0 + ipow<2>(q1[ii]) + ipow<2>(q2[ii]))*cl;
+        }
+    }
+
     template class GEqOEPropagator<double>;
+    template class GEqOEPropagator<float>;
+    template class GEqOEPropagator<long double>;
 
     /////////////////
     // Polynomials //
@@ -187,7 +318,7 @@ namespace thames::propagators {
     using thames::perturbations::baseperturbation::BasePerturbationPolynomial;
 
     template<class T, template<class> class P>
-    GEqOEPropagatorPolynomialDynamics<T, P>::GEqOEPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<const DimensionalFactors<T>> factors) : BasePropagatorPolynomialDynamics<T, P>("GEqOE", mu, perturbation, factors) {
+    GEqOEPropagatorPolynomialDynamics<T, P>::GEqOEPropagatorPolynomialDynamics(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) : BasePropagatorPolynomialDynamics<T, P>("GEqOE", mu, perturbation) {
 
     }
 
@@ -198,8 +329,8 @@ namespace thames::propagators {
 
     template<class T, template<class> class W>
     int GEqOEPropagatorPolynomialDynamics<T, W>::evaluate(const T& t, const std::vector<W<T>>& geqoe, std::vector<W<T>>& geqoedot) const {
-        // Calculate factors
-        const T mu = (m_isNonDimensional) ? m_mu/m_factors->grav : m_mu;
+        // Extract gravitational parameter
+        const T mu = m_mu;
 
         // Extract elements
         W<T> nu = geqoe[0];
@@ -217,27 +348,29 @@ namespace thames::propagators {
         W<T> cosk = cos(k);
 
         // Calculate generalised semi-major axis
-        W<T> a = pow(mu/pow(nu, 2.0), 1.0/3.0);
+        W<T> a = cbrt(mu/ipow<2>(nu));
+        W<T> sqrtmua = sqrt(mu*a);
 
         // Calculate range and range rate
         W<T> r = a*(1.0 - p1*sink - p2*cosk);
-        W<T> drdt = sqrt(mu*a)/r*(p2*sink - p1*cosk);
+        W<T> drdt = sqrtmua/r*(p2*sink - p1*cosk);
 
         // Calculate trig of the true longitude
-        W<T> alpha = 1.0/(1.0 + sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0)));
-        W<T> sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*pow(p2, 2.0))*sink - p1);
-        W<T> cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*pow(p1, 2.0))*cosk - p2);
+        W<T> beta = sqrt(1.0 - ipow<2>(p1) - ipow<2>(p2));
+        W<T> alpha = 1.0/(1.0 + beta);
+        W<T> sinl = a/r*(alpha*p1*p2*cosk + (1.0 - alpha*ipow<2>(p2))*sink - p1);
+        W<T> cosl = a/r*(alpha*p1*p2*sink + (1.0 - alpha*ipow<2>(p1))*cosk - p2);
 
         // Calculate equinocital reference frame unit vectors
-        W<T> efac = 1.0/(1.0 + pow(q1, 2.0) + pow(q2, 2.0));
+        W<T> efac = 1.0/(1.0 + ipow<2>(q1) + ipow<2>(q2));
         std::vector<W<T>> ex = {
-            efac*(1.0 - pow(q1, 2.0) + pow(q2, 2.0)),
+            efac*(1.0 - ipow<2>(q1) + ipow<2>(q2)),
             efac*(2.0*q1*q2),
             efac*(-2.0*q1)
         };
         std::vector<W<T>> ey = {
             efac*(2.0*q1*q2),
-            efac*(1.0 + pow(q1, 2.0) - pow(q2, 2.0)),
+            efac*(1.0 + ipow<2>(q1) - ipow<2>(q2)),
             efac*(2.0*q2)
         };
 
@@ -249,10 +382,10 @@ namespace thames::propagators {
         std::vector<W<T>> R = r*er;
 
         // Calculate generalised angular momentum
-        W<T> c = pow(pow(mu, 2.0)/nu, 1.0/3.0)*sqrt(1.0 - pow(p1, 2.0) - pow(p2, 2.0));
+        W<T> c = sqrtmua*beta;
 
         // Calculate angular momentum
-        W<T> h = sqrt(pow(c, 2.0) - 2.0*pow(r, 2.0)*m_perturbation->potential(t, R));
+        W<T> h = sqrt(ipow<2>(c) - 2.0*ipow<2>(r)*m_perturbation->potential(t, R));
 
         // Calculate velocity
         std::vector<W<T>> V = drdt*er + h/r*ef;
@@ -267,7 +400,7 @@ namespace thames::propagators {
         W<T> edot = Ut + thames::vector::geometry::dot3(P, V);
 
         // Calculate time derivative of nu
-        W<T> nudot = -3.0*pow(nu/pow(mu, 2.0), 1.0/3.0)*edot;
+        W<T> nudot = -3.0/sqrtmua*edot;
 
         // Calculate trig of the true longitude
         W<T> cl = thames::vector::geometry::dot3(er, ex);
@@ -281,7 +414,7 @@ namespace thames::propagators {
         std::vector<W<T>> eh = H/h;
 
         // Calculate the generalised semi-latus rectum
-        W<T> p = pow(c, 2.0)/mu;
+        W<T> p = ipow<2>(c)/mu;
 
         // Calculate perturbation components
         W<T> Fr = thames::vector::geometry::dot3(F, er);
@@ -292,15 +425,15 @@ namespace thames::propagators {
         W<T> zetatilde = 1 + zeta;
 
         // Calculate time derivatives of the second and third elements
-        W<T> p1dot = p2*((h - c)/pow(r, 2.0) - r/h*hwh*Fh) + 1.0/c*(r*drdt/c*p1 + zetatilde*p2 + zeta*cl)*(2.0*U - r*Fr) + r/mu*(zeta*p1 + zetatilde*sl)*edot;
-        W<T> p2dot = p1*(r/h*hwh*Fh - (h-c)/pow(r, 2.0)) + 1.0/c*(r*drdt/c*p2 - zetatilde*p1 - zeta*sl)*(2.0*U - r*Fr) + r/mu*(zeta*p2 + zetatilde*cl)*edot;
+        W<T> p1dot = p2*((h - c)/ipow<2>(r) - r/h*hwh*Fh) + 1.0/c*(r*drdt/c*p1 + zetatilde*p2 + zeta*cl)*(2.0*U - r*Fr) + r/mu*(zeta*p1 + zetatilde*sl)*edot;
+        W<T> p2dot = p1*(r/h*hwh*Fh - (h-c)/ipow<2>(r)) + 1.0/c*(r*drdt/c*p2 - zetatilde*p1 - zeta*sl)*(2.0*U - r*Fr) + r/mu*(zeta*p2 + zetatilde*cl)*edot;
 
         // Calculate time derivative of the generalised mean longitude
-        W<T> Ldot = nu + (h - c)/pow(r, 2.0) - r/h*hwh*Fh + (r*drdt*c/pow(mu, 2.0)*zetatilde*alpha)*edot + 1.0/c*(1.0/alpha + alpha*(1.0 - r/a))*(2.0*U - r*Fr);
+        W<T> Ldot = nu + (h - c)/ipow<2>(r) - r/h*hwh*Fh + (r*drdt*c/ipow<2>(mu)*zetatilde*alpha)*edot + 1.0/c*(1.0/alpha + alpha*(1.0 - r/a))*(2.0*U - r*Fr);
 
         // Calculate time derivatives of the remaining elements
-        W<T> q1dot = r/(2.0*h)*Fh*(1.0 + pow(q1, 2.0) + pow(q2, 2.0))*sl;
-        W<T> q2dot = r/(2.0*h)*Fh*(1.0 + pow(q1, 2.0) + pow(q2, 2.0))*cl;
+        W<T> q1dot = r/(2.0*h)*Fh*(1.0 + ipow<2>(q1) + ipow<2>(q2))*sl;
+        W<T> q2dot = r/(2.0*h)*Fh*(1.0 + ipow<2>(q1) + ipow<2>(q2))*cl;
 
         // Store derivatives
         geqoedot = {
@@ -320,7 +453,7 @@ namespace thames::propagators {
     template class GEqOEPropagatorPolynomialDynamics<double, chebyshev_polynomial>;
 
     template<class T, template<class> class P>
-    GEqOEPropagatorPolynomial<T, P>::GEqOEPropagatorPolynomial(const T& mu, const std::shared_ptr<BasePerturbationPolynomial<T, P>> perturbation, const std::shared_ptr<DimensionalFactors<T>> factors) : BasePropagatorPolynomial<T, P>(mu, perturbation, factors, std::make_shared<GEqOEPropagatorPolynomialDynamics<T, P>>(mu, perturbation, factors), GEQOE) {
+    GEqOEPropagatorPolynomial<T, P>::GEqOEPropagatorPolynomial(const T& mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) : BasePropagatorPolynomial<T, P>(mu, perturbation, GEQOE) {
 
     }
 
@@ -329,6 +462,11 @@ namespace thames::propagators {
 
     }
 
+    template<class T, template<class> class P>
+    std::shared_ptr<BasePropagatorPolynomialDynamics<T, P>> GEqOEPropagatorPolynomial<T, P>::create_dynamics(const T mu, const std::shared_ptr<const BasePerturbationPolynomial<T, P>> perturbation) const {
+        return std::make_shared<GEqOEPropagatorPolynomialDynamics<T, P>>(mu, perturbation);
+    }
+
     template class GEqOEPropagatorPolynomial<double, taylor_polynomial>;
     template class GEqOEPropagatorPolynomial<double, chebyshev_polynomial>;
 
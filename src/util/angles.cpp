@@ -40,5 +40,7 @@ namespace thames::util::angles{
         return theta - M_PI;
     }
     template double angle_wrap<double>(double);
+    template float angle_wrap<float>(float);
+    template long double angle_wrap<long double>(long double);
 
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "../../include/util/covariance.h"
+
+namespace thames::util::covariance {
+
+    template<class T>
+    std::vector<T> cholesky(const std::vector<T>& A, const std::size_t n) {
+        // Check matrix size
+        if (A.size() != n*n)
+            throw std::runtime_error("Inconsistent matrix size");
+
+        // Declare factor
+        std::vector<T> L(n*n, 0.0);
+
+        // Iterate through columns
+        for (std::size_t jj = 0; jj < n; jj++) {
+            // Calculate diagonal element
+            T diagonal = A[n*jj + jj];
+            for (std::size_t kk = 0; kk < jj; kk++)
+                diagonal -= L[n*jj + kk]*L[n*jj + kk];
+            if (!(diagonal > 0.0))
+                throw std::runtime_error("Matrix is not positive-definite");
+            L[n*jj + jj] = std::sqrt(diagonal);
+
+            // Calculate elements below the diagonal
+            for (std::size_t ii = jj + 1; ii < n; ii++) {
+                T element = A[n*ii + jj];
+                for (std::size_t kk = 0; kk < jj; kk++)
+                    element -= L[n*ii + kk]*L[n*jj + kk];
+                L[n*ii + jj] = element/L[n*jj + jj];
+            }
+        }
+
+        // Return factor
+        return L;
+    }
+    template std::vector<double> cholesky(const std::vector<double>&, const std::size_t);
+    template std::vector<float> cholesky(const std::vector<float>&, const std::size_t);
+    template std::vector<long double> cholesky(const std::vector<long double>&, const std::size_t);
+
+    template<class T>
+    std::vector<T> transform(const std::vector<T>& matrix, const std::vector<T>& covariance, const std::size_t n) {
+        // Check matrix sizes
+        if (matrix.size() != n*n || covariance.size() != n*n)
+            throw std::runtime_error("Inconsistent matrix size");
+
+        // Calculate M P
+        std::vector<T> MP(n*n, 0.0);
+        for (std::size_t ii = 0; ii < n; ii++)
+            for (std::size_t kk = 0; kk < n; kk++)
+                for (std::size_t jj = 0; jj < n; jj++)
+                    MP[n*ii + jj] += matrix[n*ii + kk]*covariance[n*kk + jj];
+
+        // Calculate M P M^T
+        std::vector<T> MPMT(n*n, 0.0);
+        for (std::size_t ii = 0; ii < n; ii++)
+            for (std::size_t jj = 0; jj < n; jj++)
+                for (std::size_t kk = 0; kk < n; kk++)
+                    MPMT[n*ii + jj] += MP[n*ii + kk]*matrix[n*jj + kk];
+
+        // Return transformed covariance
+        return MPMT;
+    }
+    template std::vector<double> transform(const std::vector<double>&, const std::vector<double>&, const std::size_t);
+    template std::vector<float> transform(const std::vector<float>&, const std::vector<float>&, const std::size_t);
+    template std::vector<long double> transform(const std::vector<long double>&, const std::vector<long double>&, const std::size_t);
+
+    template<class T>
+    void sigma_points(const std::vector<T>& mean, const std::vector<T>& covariance, const T alpha, const T beta, const T kappa, std::vector<std::vector<T>>& points, std::vector<T>& weightsMean, std::vector<T>& weightsCovariance) {
+        // Calculate scaling parameter
+        const std::size_t n = mean.size();
+        const T lambda = alpha*alpha*(n + kappa) - n;
+        if (!(n + lambda > 0.0))
+            throw std::runtime_error("Invalid unscented transform parameters");
+
+        // Calculate scaled Cholesky factor
+        std::vector<T> L = cholesky(covariance, n);
+        const T scale = std::sqrt(n + lambda);
+        for (T& element : L)
+            element *= scale;
+
+        // Generate sigma points
+        points.assign(2*n + 1, mean);
+        for (std::size_t jj = 0; jj < n; jj++) {
+            for (std::size_t ii = 0; ii < n; ii++) {
+                points[1 + jj][ii] += L[n*ii + jj];
+                points[1 + n + jj][ii] -= L[n*ii + jj];
+            }
+        }
+
+        // Calculate weights
+        weightsMean.assign(2*n + 1, 0.5/(n + lambda));
+        weightsCovariance.assign(2*n + 1, 0.5/(n + lambda));
+        weightsMean[0] = lambda/(n + lambda);
+        weightsCovariance[0] = lambda/(n + lambda) + (1.0 - alpha*alpha + beta);
+    }
+    template void sigma_points(const std::vector<double>&, const std::vector<double>&, const double, const double, const double, std::vector<std::vector<double>>&, std::vector<double>&, std::vector<double>&);
+    template void sigma_points(const std::vector<float>&, const std::vector<float>&, const float, const float, const float, std::vector<std::vector<float>>&, std::vector<float>&, std::vector<float>&);
+    template void sigma_points(const std::vector<long double>&, const std::vector<long double>&, const long double, const long double, const long double, std::vector<std::vector<long double>>&, std::vector<long double>&, std::vector<long double>&);
+
+    template<class T>
+    void reconstruct(const std::vector<std::vector<T>>& points, const std::vector<T>& weightsMean, const std::vector<T>& weightsCovariance, std::vector<T>& mean, std::vector<T>& covariance) {
+        // Calculate mean
+        const std::size_t n = points[0].size();
+        mean.assign(n, 0.0);
+        for (std::size_t kk = 0; kk < points.size(); kk++)
+            for (std::size_t ii = 0; ii < n; ii++)
+                mean[ii] += weightsMean[kk]*points[kk][ii];
+
+        // Calculate covariance
+        covariance.assign(n*n, 0.0);
+        std::vector<T> deviation(n);
+        for (std::size_t kk = 0; kk < points.size(); kk++) {
+            for (std::size_t ii = 0; ii < n; ii++)
+                deviation[ii] = points[kk][ii] - mean[ii];
+            for (std::size_t ii = 0; ii < n; ii++)
+                for (std::size_t jj = 0; jj < n; jj++)
+                    covariance[n*ii + jj] += weightsCovariance[kk]*deviation[ii]*deviation[jj];
+        }
+    }
+    template void reconstruct(const std::vector<std::vector<double>>&, const std::vector<double>&, const std::vector<double>&, std::vector<double>&, std::vector<double>&);
+    template void reconstruct(const std::vector<std::vector<float>>&, const std::vector<float>&, const std::vector<float>&, std::vector<float>&, std::vector<float>&);
+    template void reconstruct(const std::vector<std::vector<long double>>&, const std::vector<long double>&, const std::vector<long double>&, std::vector<long double>&, std::vector<long double>&);
+
+}
\ No newline at end of file
@@ -56,5 +56,7 @@ namespace thames::util::optimise{
         return (0.5*(a + b));
     }
     template double golden_section_search<double>(std::function<double (double)>, double, double, double);
+    template float golden_section_search<float>(std::function<float (float)>, float, float, float);
+    template long double golden_section_search<long double>(std::function<long double (long double)>, long double, long double, long double);
 
 }
\ No newline at end of file
@@ -22,6 +22,17 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #ifdef THAMES_USE_SMARTUQ
@@ -29,17 +40,462 @@ SOFTWARE.
 #endif
 
 #include "../../include/util/polynomials.h"
+#include "../../include/util/threadpool.h"
 
 namespace thames::util::polynomials {
 
+    void monomial_exponents(const unsigned int nvar, const unsigned int ivar, const unsigned int remainder, std::vector<unsigned int>& current, std::vector<unsigned int>& exponents) {
+        // Assign remaining degree to the last variable
+        if(ivar == nvar - 1){
+            current[ivar] = remainder;
+            exponents.insert(exponents.end(), current.begin(), current.end());
+            return;
+        }
+
+        // Iterate through exponents of the current variable in descending order
+        for(unsigned int e=remainder+1; e-->0;){
+            current[ivar] = e;
+            monomial_exponents(nvar, ivar + 1, remainder - e, current, exponents);
+        }
+    }
+
+    const MonomialTable& monomial_table(const unsigned int nvar, const unsigned int degree) {
+        // Declare table cache
+        static std::mutex mutex;
+        static std::map<std::pair<unsigned int, unsigned int>, std::unique_ptr<MonomialTable>> cache;
+
+        // Return cached table, if available
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unique_ptr<MonomialTable>& entry = cache[{nvar, degree}];
+        if(entry)
+            return *entry;
+
+        // Generate exponents in graded order
+        MonomialTable table;
+        table.nvar = nvar;
+        table.degree = degree;
+        std::vector<unsigned int> current(nvar, 0);
+        for(unsigned int d=0; d<=degree; d++)
+            monomial_exponents(nvar, 0, d, current, table.exponents);
+        table.nterms = (nvar == 0) ? 1 : table.exponents.size()/nvar;
+
+        // Index monomials by exponents
+        std::map<std::vector<unsigned int>, std::size_t> index;
+        for(std::size_t ii=0; ii<table.nterms; ii++)
+            index[std::vector<unsigned int>(table.exponents.begin() + ii*nvar, table.exponents.begin() + (ii + 1)*nvar)] = ii;
+
+        // Find parent of each monomial
+        table.parent.assign(table.nterms, 0);
+        table.variable.assign(table.nterms, 0);
+        table.power.assign(table.nterms, 0);
+        for(std::size_t ii=1; ii<table.nterms; ii++){
+            std::vector<unsigned int> exponents(table.exponents.begin() + ii*nvar, table.exponents.begin() + (ii + 1)*nvar);
+            unsigned int ivar = nvar - 1;
+            while(exponents[ivar] == 0)
+                ivar--;
+            table.variable[ii] = ivar;
+            table.power[ii] = exponents[ivar];
+            exponents[ivar] = 0;
+            table.parent[ii] = index[exponents];
+        }
+
+        // Store and return table
+        entry = std::make_unique<MonomialTable>(std::move(table));
+        return *entry;
+    }
+
+    template<class T>
+    SparsePolynomials<T> sparse_polynomials(const std::vector<std::vector<T>>& coefficients, const MonomialTable& table, const PolynomialBases basis, const T threshold) {
+        // Extract sizes
+        const std::size_t npoly = coefficients.size();
+
+        // Check dimensions
+        for(std::size_t ip=0; ip<npoly; ip++)
+            if(coefficients[ip].size() != table.nterms)
+                throw std::runtime_error("Number of coefficients does not match the monomial table");
+
+        // Calculate truncation limit for each polynomial
+        std::vector<T> limit(npoly, 0.0);
+        for(std::size_t ip=0; ip<npoly; ip++){
+            for(const T& c : coefficients[ip])
+                limit[ip] = std::max(limit[ip], std::abs(c));
+            limit[ip] *= threshold;
+        }
+
+        // Flag retained monomials, and the ancestors required to construct them
+        std::vector<bool> active(table.nterms, false), required(table.nterms, false);
+        for(std::size_t im=0; im<table.nterms; im++)
+            for(std::size_t ip=0; ip<npoly; ip++)
+                if(std::abs(coefficients[ip][im]) > limit[ip])
+                    active[im] = true;
+        for(std::size_t im=table.nterms; im-->0;)
+            if(active[im] || required[im]){
+                required[im] = true;
+                required[table.parent[im]] = true;
+            }
+        required[0] = true;
+
+        // Declare sparse polynomials
+        SparsePolynomials<T> sparse;
+        sparse.nvar = table.nvar;
+        sparse.degree = table.degree;
+        sparse.basis = basis;
+        sparse.npoly = npoly;
+
+        // Store required monomials in graded order
+        std::vector<std::size_t> position(table.nterms, 0);
+        for(std::size_t im=0; im<table.nterms; im++){
+            if(!required[im])
+                continue;
+            position[im] = sparse.monomials.size();
+            sparse.monomials.push_back(im);
+            sparse.parent.push_back(position[table.parent[im]]);
+            sparse.variable.push_back(table.variable[im]);
+            sparse.power.push_back(table.power[im]);
+            if(active[im]){
+                sparse.active.push_back(position[im]);
+                for(std::size_t ip=0; ip<npoly; ip++)
+                    sparse.coefficients.push_back((std::abs(coefficients[ip][im]) > limit[ip]) ? coefficients[ip][im] : 0.0);
+            }
+        }
+
+        // Return sparse polynomials
+        return sparse;
+    }
+    template SparsePolynomials<double> sparse_polynomials(const std::vector<std::vector<double>>&, const MonomialTable&, const PolynomialBases, const double);
+
+    template<class T>
+    void evaluate_block(const SparsePolynomials<T>& polynomials, const std::vector<std::vector<T>>& x, const std::size_t start, const std::size_t count, const std::size_t blocksize, std::vector<T>& scratch, std::vector<std::vector<T>>& y) {
+        // Extract sizes
+        const std::size_t nvar = polynomials.nvar;
+        const std::size_t ndeg = polynomials.degree + 1;
+        const std::size_t nstored = polynomials.monomials.size();
+        const std::size_t nactive = polynomials.active.size();
+        const std::size_t npoly = polynomials.npoly;
+
+        // Partition scratch memory into basis functions, monomial products, and accumulators
+        scratch.resize((nvar*ndeg + nstored + npoly)*blocksize);
+        T* functions = scratch.data();
+        T* products = functions + nvar*ndeg*blocksize;
+        T* accumulators = products + nstored*blocksize;
+
+        // Evaluate univariate basis functions for each variable
+        for(std::size_t ivar=0; ivar<nvar; ivar++){
+            T* f = functions + ivar*ndeg*blocksize;
+            for(std::size_t ib=0; ib<blocksize; ib++)
+                f[ib] = 1.0;
+            if(ndeg == 1)
+                continue;
+            for(std::size_t ib=0; ib<blocksize; ib++)
+                f[blocksize + ib] = (ib < count) ? x[start + ib][ivar] : 0.0;
+            for(std::size_t k=2; k<ndeg; k++){
+                T* fk = f + k*blocksize;
+                const T* fk1 = fk - blocksize;
+                const T* fk2 = fk1 - blocksize;
+                const T* f1 = f + blocksize;
+                if(polynomials.basis == CHEBYSHEV){
+                    // Chebyshev recurrence, T_k = 2 x T_{k-1} - T_{k-2}
+                    for(std::size_t ib=0; ib<blocksize; ib++)
+                        fk[ib] = 2.0*f1[ib]*fk1[ib] - fk2[ib];
+                } else {
+                    // Monomial recurrence, x^k = x x^{k-1}
+                    for(std::size_t ib=0; ib<blocksize; ib++)
+                        fk[ib] = f1[ib]*fk1[ib];
+                }
+            }
+        }
+
+        // Evaluate monomial products from their parents
+        for(std::size_t ib=0; ib<blocksize; ib++)
+            products[ib] = 1.0;
+        for(std::size_t im=1; im<nstored; im++){
+            T* p = products + im*blocksize;
+            const T* parent = products + polynomials.parent[im]*blocksize;
+            const T* f = functions + (polynomials.variable[im]*ndeg + polynomials.power[im])*blocksize;
+            for(std::size_t ib=0; ib<blocksize; ib++)
+                p[ib] = parent[ib]*f[ib];
+        }
+
+        // Accumulate polynomial values
+        std::fill(accumulators, accumulators + npoly*blocksize, 0.0);
+        for(std::size_t ia=0; ia<nactive; ia++){
+            const T* p = products + polynomials.active[ia]*blocksize;
+            for(std::size_t ip=0; ip<npoly; ip++){
+                const T c = polynomials.coefficients[ia*npoly + ip];
+                if(c == 0.0)
+                    continue;
+                T* a = accumulators + ip*blocksize;
+                for(std::size_t ib=0; ib<blocksize; ib++)
+                    a[ib] += c*p[ib];
+            }
+        }
+
+        // Store polynomial values
+        for(std::size_t ib=0; ib<count; ib++)
+            for(std::size_t ip=0; ip<npoly; ip++)
+                y[start + ib][ip] = accumulators[ip*blocksize + ib];
+    }
+
+    template<class T>
+    std::vector<std::vector<T>> evaluate_sparse(const SparsePolynomials<T>& polynomials, const std::vector<std::vector<T>>& x) {
+        // Extract sizes
+        const std::size_t npoly = polynomials.npoly;
+        const std::size_t npoints = x.size();
+
+        // Declare output
+        std::vector<std::vector<T>> y(npoints, std::vector<T>(npoly));
+        if(npoints == 0 || npoly == 0)
+            return y;
+
+        // Check dimensions
+        for(std::size_t ii=0; ii<npoints; ii++)
+            if(x[ii].size() != polynomials.nvar)
+                throw std::runtime_error("Dimension of evaluation point does not match the polynomials");
+
+        // Select block size to keep the monomial products within the cache
+        const std::size_t blocksize = std::clamp<std::size_t>((32768/polynomials.monomials.size())/8*8, 8, 256);
+        const std::size_t nblocks = (npoints + blocksize - 1)/blocksize;
+
+        // Evaluate a contiguous range of blocks
+        auto worker = [&](const std::size_t first, const std::size_t last){
+            std::vector<T> scratch;
+            for(std::size_t iblock=first; iblock<last; iblock++){
+                const std::size_t start = iblock*blocksize;
+                const std::size_t count = std::min(blocksize, npoints - start);
+                evaluate_block(polynomials, x, start, count, blocksize, scratch, y);
+            }
+        };
+
+        // Evaluate in the calling thread, unless there are enough blocks to share and the caller is not already a pool worker
+        const std::size_t ngroups = nblocks/4;
+        if(ngroups < 2 || thames::util::threadpool::WorkStealingPool::is_worker()){
+            worker(0, nblocks);
+            return y;
+        }
+
+        // Distribute groups of blocks across the shared pool
+        thames::util::threadpool::WorkStealingPool& pool = thames::util::threadpool::WorkStealingPool::shared();
+        const std::size_t nthreads = std::min(pool.size(), ngroups);
+        pool.parallel_for(nthreads, [&](const std::size_t ithread){
+            worker(nblocks*ithread/nthreads, nblocks*(ithread + 1)/nthreads);
+        });
+
+        // Return polynomial values
+        return y;
+    }
+    template std::vector<std::vector<double>> evaluate_sparse(const SparsePolynomials<double>&, const std::vector<std::vector<double>>&);
+
+    template<class T>
+    std::vector<std::vector<T>> evaluate_coefficients(const std::vector<std::vector<T>>& coefficients, const MonomialTable& table, const PolynomialBases basis, const std::vector<std::vector<T>>& x) {
+        // Evaluate sparse polynomials, retaining all non-zero coefficients
+        return evaluate_sparse(sparse_polynomials<T>(coefficients, table, basis, 0.0), x);
+    }
+    template std::vector<std::vector<double>> evaluate_coefficients(const std::vector<std::vector<double>>&, const MonomialTable&, const PolynomialBases, const std::vector<std::vector<double>>&);
+
+    template<class T>
+    T nonlinearity_indicator(const std::vector<std::vector<T>>& coefficients, const MonomialTable& table, std::vector<T>& scores) {
+        // Reset variable scores
+        scores.assign(table.nvar, 0.0);
+
+        // Return zero for linear polynomials
+        if(table.degree < 2)
+            return 0.0;
+
+        // Declare indicator
+        T indicator = 0.0;
+
+        // Iterate through polynomials
+        for(const std::vector<T>& c : coefficients){
+            // Check dimensions
+            if(c.size() != table.nterms)
+                throw std::runtime_error("Number of coefficients does not match the monomial table");
+
+            // Sum magnitudes of linear and highest-degree coefficients
+            T linear = 0.0, highest = 0.0;
+            std::vector<T> contribution(table.nvar, 0.0);
+            for(std::size_t im=1; im<table.nterms; im++){
+                // Calculate monomial degree
+                unsigned int degree = 0;
+                for(unsigned int ivar=0; ivar<table.nvar; ivar++)
+                    degree += table.exponents[im*table.nvar + ivar];
+
+                if(degree == 1){
+                    linear += std::abs(c[im]);
+                } else if(degree == table.degree){
+                    highest += std::abs(c[im]);
+                    for(unsigned int ivar=0; ivar<table.nvar; ivar++)
+                        contribution[ivar] += std::abs(c[im])*table.exponents[im*table.nvar + ivar];
+                }
+            }
+
+            // Skip polynomials without a linear part
+            if(linear == 0.0)
+                continue;
+
+            // Update indicator and variable scores
+            indicator = std::max(indicator, highest/linear);
+            for(unsigned int ivar=0; ivar<table.nvar; ivar++)
+                scores[ivar] += contribution[ivar]/(linear*table.degree);
+        }
+
+        // Return indicator
+        return indicator;
+    }
+    template double nonlinearity_indicator(const std::vector<std::vector<double>>&, const MonomialTable&, std::vector<double>&);
+
     #ifdef THAMES_USE_SMARTUQ
 
     using namespace smartuq::polynomial;
 
+    template<>
+    PolynomialBases polynomial_basis<taylor_polynomial>() {
+        return MONOMIAL;
+    }
+
+    template<>
+    PolynomialBases polynomial_basis<chebyshev_polynomial>() {
+        return CHEBYSHEV;
+    }
+
+    // Key of a multiplication table, by number of variables, maximum degree, and basis
+    using MultiplicationTableKey = std::tuple<unsigned int, unsigned int, PolynomialBases>;
+
+    // Multiplication table resident in SMART-UQ for a basis
+    struct MultiplicationTableResident {
+        /// Key of the resident table
+        MultiplicationTableKey key;
+        /// Number of leases which displaced another table to make this table resident
+        unsigned int displacements = 0;
+        /// Thread holding the displacing leases
+        std::thread::id owner;
+    };
+
+    // Process-wide registry of the multiplication tables of a numeric type
+    template<class T>
+    struct MultiplicationTableRegistry {
+        /// Mutex guarding the registry
+        std::mutex mutex;
+        /// Condition variable notified when leases are released
+        std::condition_variable released;
+        /// Number of leases held on each table
+        std::map<MultiplicationTableKey, std::size_t> counts;
+        /// Table resident in SMART-UQ for each basis
+        std::map<PolynomialBases, MultiplicationTableResident> residents;
+
+        /// Retrieve the process-wide registry
+        static MultiplicationTableRegistry& instance() {
+            static MultiplicationTableRegistry registry;
+            return registry;
+        }
+    };
+
+    // Leases of the multiplication tables of a numeric type held by the current thread
+    template<class T>
+    struct MultiplicationTableThreadState {
+        /// Number of leases held on each table
+        std::map<MultiplicationTableKey, std::size_t> counts;
+
+        /// Retrieve the state for the current thread
+        static MultiplicationTableThreadState& instance() {
+            static thread_local MultiplicationTableThreadState state;
+            return state;
+        }
+    };
+
+    template<class T, template<class> class P>
+    MultiplicationTableLease<T, P>::MultiplicationTableLease(const unsigned int nvar, const unsigned int degree) : m_nvar(nvar), m_degree(degree), m_isDisplacing(false) {
+        // Retrieve registry and thread states
+        MultiplicationTableRegistry<T>& registry = MultiplicationTableRegistry<T>::instance();
+        MultiplicationTableThreadState<T>& thread = MultiplicationTableThreadState<T>::instance();
+        const PolynomialBases basis = polynomial_basis<P>();
+        const MultiplicationTableKey key(nvar, degree, basis);
+
+        std::unique_lock<std::mutex> lock(registry.mutex);
+        while(true){
+            // Build table if no table of the basis is resident
+            auto resident = registry.residents.find(basis);
+            if(resident == registry.residents.end()){
+                P<T>::initialize_M(nvar, degree);
+                registry.residents[basis].key = key;
+                break;
+            }
+
+            // Share resident table, unless it is displacing a table leased by another thread
+            if(resident->second.key == key && (resident->second.displacements == 0 || resident->second.owner == std::this_thread::get_id()))
+                break;
+
+            // Replace resident table if it is not leased
+            const MultiplicationTableKey resident_key = resident->second.key;
+            if(registry.counts[resident_key] == 0){
+                P<T>::initialize_M(nvar, degree);
+                resident->second.key = key;
+                break;
+            }
+
+            // Displace resident table if all of its leases are held by the current thread, and restore it on release
+            if(registry.counts[resident_key] == thread.counts[resident_key]){
+                P<T>::initialize_M(nvar, degree);
+                m_isDisplacing = true;
+                m_displacedNvar = std::get<0>(resident_key);
+                m_displacedDegree = std::get<1>(resident_key);
+                resident->second.key = key;
+                resident->second.displacements++;
+                resident->second.owner = std::this_thread::get_id();
+                break;
+            }
+
+            // Wait for leases on the resident table to be released
+            registry.released.wait(lock);
+        }
+
+        // Record lease
+        registry.counts[key]++;
+        thread.counts[key]++;
+    }
+
+    template<class T, template<class> class P>
+    MultiplicationTableLease<T, P>::~MultiplicationTableLease() {
+        // Retrieve registry and thread states
+        MultiplicationTableRegistry<T>& registry = MultiplicationTableRegistry<T>::instance();
+        MultiplicationTableThreadState<T>& thread = MultiplicationTableThreadState<T>::instance();
+        const PolynomialBases basis = polynomial_basis<P>();
+        const MultiplicationTableKey key(m_nvar, m_degree, basis);
+
+        {
+            // Release lease
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.counts[key]--;
+            thread.counts[key]--;
+
+            // Restore displaced table
+            if(m_isDisplacing){
+                MultiplicationTableResident& resident = registry.residents[basis];
+                P<T>::initialize_M(m_displacedNvar, m_displacedDegree);
+                resident.key = MultiplicationTableKey(m_displacedNvar, m_displacedDegree, basis);
+                resident.displacements--;
+            }
+        }
+
+        // Notify waiting leases
+        registry.released.notify_all();
+    }
+
+    template class MultiplicationTableLease<double, taylor_polynomial>;
+    template class MultiplicationTableLease<double, chebyshev_polynomial>;
+
+    template<class T, template<class> class P>
+    void initialise_multiplication_table(const unsigned int nvar, const unsigned int degree) {
+        // Acquire and release lease
+        MultiplicationTableLease<T, P> lease(nvar, degree);
+    }
+    template void initialise_multiplication_table<double, taylor_polynomial>(const unsigned int, const unsigned int);
+    template void initialise_multiplication_table<double, chebyshev_polynomial>(const unsigned int, const unsigned int);
+
     template<class T, template<class> class P>
     std::vector<T> evaluate_polynomials(const std::vector<P<T>>& polynomials, const std::vector<T>& x) {
         // Declare point state vector
         std::vector<T> numeric;
+        numeric.reserve(polynomials.size());
 
         // Evaluate each polynomial
         for(std::size_t ii=0; ii<polynomials.size(); ii++)
@@ -52,19 +508,67 @@ namespace thames::util::polynomials {
     template std::vector<double> evaluate_polynomials(const std::vector<chebyshev_polynomial<double>>&, const std::vector<double>&);
 
     template<class T, template<class> class P>
-    std::vector<std::vector<T>> evaluate_polynomials(const std::vector<P<T>>& polynomials, const std::vector<std::vector<T>>& x){
-        // Declare vector for states
-        std::vector<std::vector<T>> numeric(x.size(), std::vector<T>(x[0].size()));
+    std::vector<std::vector<T>> evaluate_polynomials(const std::vector<P<T>>& polynomials, const std::vector<std::vector<T>>& x, const T threshold){
+        // Return early for empty sets
+        if(x.empty() || polynomials.empty())
+            return std::vector<std::vector<T>>(x.size());
 
-        // Iterate through states
-        for(std::size_t ii=0; ii<x.size(); ii++)
-            numeric[ii] = evaluate_polynomials(polynomials, x[ii]);
+        // Retrieve monomial table
+        const unsigned int nvar = polynomials[0].get_nvar();
+        const unsigned int degree = polynomials[0].get_degree();
+        const MonomialTable& table = monomial_table(nvar, degree);
 
-        // Return point state vectors
-        return numeric;
+        // Extract coefficients, which SMART-UQ stores in the graded order of the monomial table for every basis
+        std::vector<std::vector<T>> coefficients;
+        coefficients.reserve(polynomials.size());
+        for(const P<T>& polynomial : polynomials){
+            if(polynomial.get_nvar() != (int) nvar || polynomial.get_degree() != (int) degree)
+                throw std::runtime_error("Inconsistent numbers of variables or degrees of polynomials");
+            coefficients.push_back(polynomial.get_coeffs());
+        }
+
+        // Check the coefficient layout against SMART-UQ at a probe point with distinct components, so that permuted monomials are detected
+        // NOTE: every basis function is bounded by one within the unit hypercube, so the sum of the coefficient magnitudes bounds each value
+        std::vector<T> probe(nvar);
+        for(unsigned int ivar=0; ivar<nvar; ivar++)
+            probe[ivar] = (T) (ivar + 1)/(nvar + 1);
+        const std::vector<T> values = evaluate_coefficients(coefficients, table, polynomial_basis<P>(), {probe})[0];
+        for(std::size_t ii=0; ii<polynomials.size(); ii++){
+            T scale = 0.0;
+            for(const T& coefficient : coefficients[ii])
+                scale += std::fabs(coefficient);
+            if(std::fabs(values[ii] - polynomials[ii].evaluate(probe)) > std::sqrt(std::numeric_limits<T>::epsilon())*scale)
+                throw std::runtime_error("Polynomial coefficients are not stored in the order of the monomial table");
+        }
+
+        // Evaluate with batched kernel in the basis of the polynomial type
+        return evaluate_sparse(sparse_polynomials(coefficients, table, polynomial_basis<P>(), threshold), x);
+    }
+    template std::vector<std::vector<double>> evaluate_polynomials(const std::vector<taylor_polynomial<double>>&, const std::vector<std::vector<double>>&, const double);
+    template std::vector<std::vector<double>> evaluate_polynomials(const std::vector<chebyshev_polynomial<double>>&, const std::vector<std::vector<double>>&, const double);
+
+    template<class T, template<class> class P>
+    T nonlinearity_indicator(const std::vector<P<T>>& polynomials, std::vector<T>& scores) {
+        // Return zero for empty sets
+        if(polynomials.empty()){
+            scores.clear();
+            return 0.0;
+        }
+
+        // Retrieve monomial table
+        const MonomialTable& table = monomial_table(polynomials[0].get_nvar(), polynomials[0].get_degree());
+
+        // Extract coefficients
+        std::vector<std::vector<T>> coefficients;
+        coefficients.reserve(polynomials.size());
+        for(const P<T>& polynomial : polynomials)
+            coefficients.push_back(polynomial.get_coeffs());
+
+        // Return indicator
+        return nonlinearity_indicator(coefficients, table, scores);
     }
-    template std::vector<std::vector<double>> evaluate_polynomials(const std::vector<taylor_polynomial<double>>&, const std::vector<std::vector<double>>&);
-    template std::vector<std::vector<double>> evaluate_polynomials(const std::vector<chebyshev_polynomial<double>>&, const std::vector<std::vector<double>>&);
+    template double nonlinearity_indicator(const std::vector<taylor_polynomial<double>>&, std::vector<double>&);
+    template double nonlinearity_indicator(const std::vector<chebyshev_polynomial<double>>&, std::vector<double>&);
 
     #endif
 
@@ -0,0 +1,66 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+
+#ifdef THAMES_USE_SMARTUQ
+#include "../../external/smart-uq/include/Polynomial/smartuq_polynomial.h"
+#endif
+
+#include "../../include/util/powers.h"
+
+namespace thames::util::powers{
+
+    ///////////
+    // Reals //
+    ///////////
+
+    template<class T>
+    T cbrt(const T& x){
+        // Return cube root
+        return std::cbrt(x);
+    }
+    template double cbrt<double>(const double&);
+    template float cbrt<float>(const float&);
+    template long double cbrt<long double>(const long double&);
+
+    /////////////////
+    // Polynomials //
+    /////////////////
+
+    #ifdef THAMES_USE_SMARTUQ
+
+    using namespace smartuq::polynomial;
+
+    template<class T, template<class> class P>
+    P<T> cbrt(const P<T>& x){
+        // Return cube root
+        return pow(x, 1.0/3.0);
+    }
+    template taylor_polynomial<double> cbrt(const taylor_polynomial<double>&);
+    template chebyshev_polynomial<double> cbrt(const chebyshev_polynomial<double>&);
+
+    #endif
+
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../../include/util/profiling.h"
+
+namespace thames::util::profiling {
+
+    /**
+     * @brief Structure to store the process-wide profiling records.
+     * 
+     * @author Max Hallgarten La Casta
+     * @date 2026-10-19
+     * 
+     */
+    struct Profiler {
+        /// Flag for whether profiling is enabled
+        std::atomic<bool> enabled{false};
+
+        /// Flag for whether intervals are stored for a Chrome trace
+        bool trace = false;
+
+        /// Interval between sampled evaluations of the perturbation models
+        std::atomic<unsigned int> perturbationSampling{0};
+
+        /// Generation of the sampling settings, so that threads restart their sampling counters
+        std::atomic<unsigned int> generation{0};
+
+        /// Start of profiling
+        Clock::time_point origin;
+
+        /// Mutex guarding the records
+        std::mutex mutex;
+
+        /// Accumulated time of each timer
+        std::map<std::string, TimerStatistics> timers;
+
+        /// Recorded intervals (name, thread index, start and duration in microseconds)
+        std::vector<nlohmann::json> events;
+
+        /// Indices of the recording threads
+        std::map<std::thread::id, std::size_t> threads;
+    };
+
+    Profiler& profiler() {
+        // Return process-wide profiler
+        static Profiler instance;
+        return instance;
+    }
+
+    void enable(const bool trace, const unsigned int perturbationSampling) {
+        // Clear records and set flags
+        Profiler& state = profiler();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.timers.clear();
+        state.events.clear();
+        state.threads.clear();
+        state.trace = trace;
+        state.origin = Clock::now();
+        state.perturbationSampling = perturbationSampling;
+        state.generation++;
+        state.enabled = true;
+    }
+
+    void disable() {
+        profiler().enabled = false;
+    }
+
+    bool is_enabled() {
+        return profiler().enabled.load(std::memory_order_relaxed);
+    }
+
+    bool sample_perturbation() {
+        // Skip sampling unless enabled
+        Profiler& state = profiler();
+        if (!state.enabled.load(std::memory_order_relaxed))
+            return false;
+        const unsigned int sampling = state.perturbationSampling.load(std::memory_order_relaxed);
+        if (sampling == 0)
+            return false;
+
+        // Count evaluations on each thread, restarting when profiling is enabled again
+        thread_local unsigned int counter = 0, generation = 0;
+        const unsigned int generation_current = state.generation.load(std::memory_order_relaxed);
+        if (generation != generation_current) {
+            generation = generation_current;
+            counter = 0;
+        }
+        return (counter++ % sampling) == 0;
+    }
+
+    void record(const std::string& name, const Clock::time_point start, const Clock::time_point end) {
+        // Accumulate timer
+        Profiler& state = profiler();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        TimerStatistics& timer = state.timers[name];
+        timer.name = name;
+        timer.count++;
+        timer.totalTime += std::chrono::duration<double>(end - start).count();
+
+        // Store interval for the trace
+        if (state.trace) {
+            const std::size_t thread = state.threads.emplace(std::this_thread::get_id(), state.threads.size()).first->second;
+            state.events.push_back({
+                {"name", name},
+                {"cat", "thames"},
+                {"ph", "X"},
+                {"pid", 0},
+                {"tid", thread},
+                {"ts", std::chrono::duration<double, std::micro>(start - state.origin).count()},
+                {"dur", std::chrono::duration<double, std::micro>(end - start).count()}
+            });
+        }
+    }
+
+    std::vector<TimerStatistics> report() {
+        // Copy timers in name order
+        Profiler& state = profiler();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        std::vector<TimerStatistics> timers;
+        for (const auto& timer : state.timers)
+            timers.push_back(timer.second);
+        return timers;
+    }
+
+    void save_trace(const std::string& filepath) {
+        // Open file
+        std::ofstream file(filepath);
+        if (!file)
+            throw std::runtime_error("Unable to open trace file");
+
+        // Write trace events
+        Profiler& state = profiler();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        file << nlohmann::json({{"traceEvents", state.events}, {"displayTimeUnit", "ms"}}).dump();
+    }
+
+    ScopedTimer::ScopedTimer(const char* name, const bool active) : m_active(active && is_enabled()) {
+        // Start interval if recording
+        if (m_active) {
+            m_name = name;
+            m_start = Clock::now();
+        }
+    }
+
+    ScopedTimer::~ScopedTimer() {
+        // Record interval, unless already stopped
+        stop();
+    }
+
+    void ScopedTimer::stop() {
+        // Record interval once
+        if (m_active) {
+            record(m_name, m_start, Clock::now());
+            m_active = false;
+        }
+    }
+
+}
\ No newline at end of file
@@ -22,8 +22,11 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <limits>
+#include <stdexcept>
 
 #ifdef THAMES_USE_SMARTUQ
 #include "../../external/smart-uq/include/Polynomial/smartuq_polynomial.h"
@@ -50,6 +53,89 @@ namespace thames::util::root{
         return x0;
     }
     template double golden_section_search<double>(std::function<double (double)>, double, double, double);
+    template float golden_section_search<float>(std::function<float (float)>, float, float, float);
+    template long double golden_section_search<long double>(std::function<long double (long double)>, long double, long double, long double);
+
+    template<class T>
+    T brent(const std::function<T (T)>& func, T a, T b, T tol){
+        // Evaluate function at the boundaries
+        T fa = func(a);
+        T fb = func(b);
+
+        // Throw error if the root is not bracketed
+        if((fa > 0.0 && fb > 0.0) || (fa < 0.0 && fb < 0.0))
+            throw std::runtime_error("Root is not bracketed");
+
+        // Declare contrapoint, previous steps, and function value at the contrapoint
+        T c = b, fc = fb, d = b - a, e = d;
+
+        // Iterate until converged
+        while(true){
+            // Move contrapoint to keep the root bracketed between the current and contrapoint
+            if((fb > 0.0 && fc > 0.0) || (fb < 0.0 && fc < 0.0)){
+                c = a;
+                fc = fa;
+                d = b - a;
+                e = d;
+            }
+
+            // Swap to keep the current point as the best approximation
+            if(fabs(fc) < fabs(fb)){
+                a = b;
+                b = c;
+                c = a;
+                fa = fb;
+                fb = fc;
+                fc = fa;
+            }
+
+            // Converged if the bracket is smaller than the tolerance, limited by the precision of the numeric type, or the root is found
+            const T tol1 = 2.0*std::numeric_limits<T>::epsilon()*fabs(b) + 0.5*tol;
+            const T xm = 0.5*(c - b);
+            if(fabs(xm) <= tol1 || fb == 0.0)
+                return b;
+
+            if(fabs(e) >= tol1 && fabs(fa) > fabs(fb)){
+                // Attempt secant or inverse quadratic interpolation
+                T p, q;
+                const T s = fb/fa;
+                if(a == c){
+                    p = 2.0*xm*s;
+                    q = 1.0 - s;
+                } else {
+                    const T r = fb/fc;
+                    q = fa/fc;
+                    p = s*(2.0*xm*q*(q - r) - (b - a)*(r - 1.0));
+                    q = (q - 1.0)*(r - 1.0)*(s - 1.0);
+                }
+                if(p > 0.0)
+                    q = -q;
+                p = fabs(p);
+
+                // Accept interpolation if it remains within the bracket and converges quickly enough, otherwise bisect
+                if(2.0*p < std::min<T>(3.0*xm*q - fabs(tol1*q), fabs(e*q))){
+                    e = d;
+                    d = p/q;
+                } else {
+                    d = xm;
+                    e = d;
+                }
+            } else {
+                // Bisect
+                d = xm;
+                e = d;
+            }
+
+            // Update previous point, and take step of at least the tolerance
+            a = b;
+            fa = fb;
+            b += (fabs(d) > tol1) ? d : ((xm > 0.0) ? tol1 : -tol1);
+            fb = func(b);
+        }
+    }
+    template double brent<double>(const std::function<double (double)>&, double, double, double);
+    template float brent<float>(const std::function<float (float)>&, float, float, float);
+    template long double brent<long double>(const std::function<long double (long double)>&, long double, long double, long double);
 
     template<class T>
     T newton_raphson(const std::function<T (T)>& func, const std::function<T (T)>& dfunc, T xn, T tol){
@@ -64,8 +150,8 @@ namespace thames::util::root{
             // Update approximation
             xn1 = xn - func(xn)/dfunc(xn);
 
-            // Converged if update is smaller than tolerance
-            if(fabs(xn1 - xn) < tol)
+            // Converged if update is smaller than tolerance, limited by the precision of the numeric type
+            if(fabs(xn1 - xn) < std::max<T>(tol, 4*std::numeric_limits<T>::epsilon()*fabs(xn1)))
                 converged = true;
 
             // Update previous approximation
@@ -76,6 +162,8 @@ namespace thames::util::root{
         return xn1;
     }
     template double newton_raphson<double>(const std::function<double (double)>&, const std::function<double (double)>&, double, double);
+    template float newton_raphson<float>(const std::function<float (float)>&, const std::function<float (float)>&, float, float);
+    template long double newton_raphson<long double>(const std::function<long double (long double)>&, const std::function<long double (long double)>&, long double, long double);
 
     /////////////////
     // Polynomials //
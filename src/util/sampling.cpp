@@ -22,9 +22,15 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
 #include <vector>
 
 #include "../../include/util/sampling.h"
+#include "../../include/util/threadpool.h"
 
 namespace thames::util::sampling {
 
@@ -49,42 +55,298 @@ namespace thames::util::sampling {
         return points;
     }
     template std::vector<double> linspace(const double, const double, const unsigned int);
+    template std::vector<float> linspace(const float, const float, const unsigned int);
+    template std::vector<long double> linspace(const long double, const long double, const unsigned int);
 
     template<class T>
-    std::vector<std::vector<T>> cartesian_permutations(const std::vector<std::vector<T>>& points) {
-        // Declare output vector
-        std::vector<std::vector<T>> permuations;
-
-        // Iterate through provided points
-        // TODO: fix horrible implementation to avoid so many nested loops
-        for(std::size_t ix=0; ix < points[0].size(); ix++){
-            for(std::size_t iy=0; iy < points[1].size(); iy++){
-                for(std::size_t iz=0; iz < points[2].size(); iz++){
-                    for(std::size_t ivx=0; ivx < points[3].size(); ivx++){
-                        for(std::size_t ivy=0; ivy < points[4].size(); ivy++){
-                            for(std::size_t ivz=0; ivz < points[5].size(); ivz++){
-                                // Generate current permutation
-                                std::vector<T> permutation = {
-                                    points[0][ix],
-                                    points[1][iy],
-                                    points[2][iz],
-                                    points[3][ivx],
-                                    points[4][ivy],
-                                    points[5][ivz]
-                                };
-
-                                // Store permuation
-                                permuations.push_back(permutation);
-                            }
-                        }
-                    }
-                }
+    CartesianGrid<T>::CartesianGrid(const std::vector<std::vector<T>>& points) : m_points(points) {
+        // Calculate number of permutations
+        m_size = m_points.empty() ? 0 : 1;
+        for (const std::vector<T>& axis : m_points)
+            m_size *= axis.size();
+    }
+
+    template<class T>
+    std::size_t CartesianGrid<T>::size() const {
+        return m_size;
+    }
+
+    template<class T>
+    std::size_t CartesianGrid<T>::dimension() const {
+        return m_points.size();
+    }
+
+    template<class T>
+    std::vector<T> CartesianGrid<T>::state(const std::size_t index) const {
+        // Check index
+        if (index >= m_size)
+            throw std::runtime_error("Grid index out of range");
+
+        // Decode index, with the last variable varying fastest
+        std::vector<T> permutation(m_points.size());
+        std::size_t remainder = index;
+        for (std::size_t jj = m_points.size(); jj-- > 0;) {
+            permutation[jj] = m_points[jj][remainder % m_points[jj].size()];
+            remainder /= m_points[jj].size();
+        }
+
+        // Return permutation
+        return permutation;
+    }
+
+    template<class T>
+    std::vector<std::vector<T>> CartesianGrid<T>::read(const std::size_t start, const std::size_t count) const {
+        // Check range
+        if (start + count > m_size)
+            throw std::runtime_error("Grid range out of bounds");
+        std::vector<std::vector<T>> permutations;
+        if (count == 0)
+            return permutations;
+        permutations.reserve(count);
+
+        // Decode indices of the first permutation
+        std::vector<std::size_t> indices(m_points.size());
+        std::size_t remainder = start;
+        for (std::size_t jj = m_points.size(); jj-- > 0;) {
+            indices[jj] = remainder % m_points[jj].size();
+            remainder /= m_points[jj].size();
+        }
+
+        // Generate permutations, incrementing the indices as an odometer
+        std::vector<T> permutation = state(start);
+        for (std::size_t ii = 0; ii < count; ii++) {
+            permutations.push_back(permutation);
+            for (std::size_t jj = m_points.size(); jj-- > 0;) {
+                indices[jj] = (indices[jj] + 1 == m_points[jj].size()) ? 0 : indices[jj] + 1;
+                permutation[jj] = m_points[jj][indices[jj]];
+                if (indices[jj] != 0)
+                    break;
             }
         }
 
         // Return permutations
-        return permuations;
+        return permutations;
+    }
+
+    template<class T>
+    std::vector<std::pair<std::size_t, std::size_t>> CartesianGrid<T>::partition(const std::size_t nparts) const {
+        // Check number of partitions
+        if (nparts == 0)
+            throw std::runtime_error("Grid must be partitioned into at least one range");
+
+        // Split the index space, with the remainder spread over the first partitions
+        std::vector<std::pair<std::size_t, std::size_t>> ranges;
+        const std::size_t base = m_size/nparts, extra = m_size % nparts;
+        std::size_t start = 0;
+        for (std::size_t ii = 0; ii < nparts; ii++) {
+            const std::size_t end = start + base + ((ii < extra) ? 1 : 0);
+            ranges.push_back({start, end});
+            start = end;
+        }
+
+        // Return ranges
+        return ranges;
+    }
+
+    template class CartesianGrid<double>;
+    template class CartesianGrid<float>;
+    template class CartesianGrid<long double>;
+
+    template<class T>
+    std::vector<std::vector<T>> cartesian_permutations(const std::vector<std::vector<T>>& points) {
+        // Generate all permutations of the grid
+        const CartesianGrid<T> grid(points);
+        return grid.read(0, grid.size());
     }
     template std::vector<std::vector<double>> cartesian_permutations(const std::vector<std::vector<double>>&);
+    template std::vector<std::vector<float>> cartesian_permutations(const std::vector<std::vector<float>>&);
+    template std::vector<std::vector<long double>> cartesian_permutations(const std::vector<std::vector<long double>>&);
+
+
+    template<class T>
+    std::vector<T> halton(const std::size_t n, const std::size_t dim, const std::size_t offset) {
+        // Find the first primes as bases
+        std::vector<std::size_t> bases;
+        for (std::size_t candidate = 2; bases.size() < dim; candidate++) {
+            bool isPrime = true;
+            for (const std::size_t base : bases)
+                if (candidate % base == 0) {
+                    isPrime = false;
+                    break;
+                }
+            if (isPrime)
+                bases.push_back(candidate);
+        }
+
+        // Generate points
+        std::vector<T> points(n*dim);
+        for (std::size_t ii = 0; ii < n; ii++) {
+            for (std::size_t jj = 0; jj < dim; jj++) {
+                // Calculate radical inverse of the index
+                std::size_t index = offset + ii + 1;
+                T fraction = 1.0, value = 0.0;
+                while (index > 0) {
+                    fraction /= bases[jj];
+                    value += fraction*(index % bases[jj]);
+                    index /= bases[jj];
+                }
+                points[dim*ii + jj] = value;
+            }
+        }
+
+        // Return points
+        return points;
+    }
+    template std::vector<double> halton(const std::size_t, const std::size_t, const std::size_t);
+    template std::vector<float> halton(const std::size_t, const std::size_t, const std::size_t);
+    template std::vector<long double> halton(const std::size_t, const std::size_t, const std::size_t);
+
+    template<class T>
+    std::vector<T> sobol(const std::size_t n, const std::size_t dim, const std::size_t offset) {
+        // Joe-Kuo primitive polynomial degrees, coefficients, and initial direction numbers for the dimensions after the first
+        const std::size_t ndim = 8;
+        const unsigned int degrees[ndim - 1] = {1, 2, 3, 3, 4, 4, 5};
+        const unsigned int coefficients[ndim - 1] = {0, 1, 1, 2, 1, 4, 2};
+        const std::uint32_t initial[ndim - 1][5] = {{1}, {1, 3}, {1, 3, 1}, {1, 1, 1}, {1, 1, 3, 3}, {1, 3, 5, 13}, {1, 1, 5, 5, 17}};
+
+        // Check dimensions and sequence length
+        const unsigned int nbits = 32;
+        if (dim > ndim)
+            throw std::runtime_error("Sobol sequence is only supported for up to eight dimensions");
+        if (offset + n >= (std::size_t(1) << nbits))
+            throw std::runtime_error("Sobol sequence exhausted");
+
+        // Calculate direction numbers
+        std::vector<std::vector<std::uint32_t>> directions(dim, std::vector<std::uint32_t>(nbits));
+        for (std::size_t jj = 0; jj < dim; jj++) {
+            // The first dimension is the van der Corput sequence in base two
+            if (jj == 0) {
+                for (unsigned int kk = 0; kk < nbits; kk++)
+                    directions[jj][kk] = std::uint32_t(1) << (nbits - 1 - kk);
+                continue;
+            }
+
+            // Scale initial direction numbers
+            const unsigned int s = degrees[jj - 1];
+            const unsigned int a = coefficients[jj - 1];
+            for (unsigned int kk = 0; kk < s; kk++)
+                directions[jj][kk] = initial[jj - 1][kk] << (nbits - 1 - kk);
+
+            // Apply recurrence of the primitive polynomial
+            for (unsigned int kk = s; kk < nbits; kk++) {
+                directions[jj][kk] = directions[jj][kk - s] ^ (directions[jj][kk - s] >> s);
+                for (unsigned int ll = 1; ll < s; ll++)
+                    if ((a >> (s - 1 - ll)) & 1)
+                        directions[jj][kk] ^= directions[jj][kk - ll];
+            }
+        }
+
+        // Generate points
+        std::vector<T> points(n*dim);
+        const T scale = 1.0/T(std::uint64_t(1) << nbits);
+        for (std::size_t ii = 0; ii < n; ii++) {
+            const std::size_t index = offset + ii + 1;
+            for (std::size_t jj = 0; jj < dim; jj++) {
+                // Combine direction numbers of the set bits of the index
+                std::uint32_t value = 0;
+                for (unsigned int kk = 0; kk < nbits; kk++)
+                    if ((index >> kk) & 1)
+                        value ^= directions[jj][kk];
+                points[dim*ii + jj] = value*scale;
+            }
+        }
+
+        // Return points
+        return points;
+    }
+    template std::vector<double> sobol(const std::size_t, const std::size_t, const std::size_t);
+    template std::vector<float> sobol(const std::size_t, const std::size_t, const std::size_t);
+    template std::vector<long double> sobol(const std::size_t, const std::size_t, const std::size_t);
+
+    template<class T>
+    std::vector<T> latin_hypercube(const std::size_t n, const std::size_t dim, const unsigned int seed) {
+        // Generate points
+        std::vector<T> points(n*dim);
+        std::vector<std::size_t> strata(n);
+        for (std::size_t jj = 0; jj < dim; jj++) {
+            // Seed generator for the dimension
+            std::mt19937_64 generator(seed + jj);
+            std::uniform_real_distribution<T> distribution(0.0, 1.0);
+
+            // Shuffle strata
+            std::iota(strata.begin(), strata.end(), 0);
+            std::shuffle(strata.begin(), strata.end(), generator);
+
+            // Sample within each stratum
+            for (std::size_t ii = 0; ii < n; ii++)
+                points[dim*ii + jj] = (strata[ii] + distribution(generator))/n;
+        }
+
+        // Return points
+        return points;
+    }
+    template std::vector<double> latin_hypercube(const std::size_t, const std::size_t, const unsigned int);
+    template std::vector<float> latin_hypercube(const std::size_t, const std::size_t, const unsigned int);
+    template std::vector<long double> latin_hypercube(const std::size_t, const std::size_t, const unsigned int);
+
+    template<class T>
+    std::vector<T> generate_samples(const SamplingMethods method, const std::size_t n, const std::vector<T>& lower, const std::vector<T>& upper, const unsigned int seed, const unsigned int threads) {
+        // Check bounds
+        const std::size_t dim = lower.size();
+        if (upper.size() != dim)
+            throw std::runtime_error("Inconsistent sampling bounds");
+
+        // Declare generation of a block of samples in the unit hypercube
+        std::vector<T> samples(n*dim);
+        auto generate_block = [&](const std::size_t start, const std::size_t end) {
+            std::vector<T> block;
+            if (method == SOBOL) {
+                block = sobol<T>(end - start, dim, start);
+            } else if (method == HALTON) {
+                block = halton<T>(end - start, dim, start);
+            } else {
+                throw std::runtime_error("Unsupported sampling method requested");
+            }
+            std::copy(block.begin(), block.end(), samples.begin() + dim*start);
+        };
+
+        // Declare generation of a dimension of Latin hypercube samples
+        auto generate_dimension = [&](const std::size_t jj) {
+            const std::vector<T> column = latin_hypercube<T>(n, 1, seed + jj);
+            for (std::size_t ii = 0; ii < n; ii++)
+                samples[dim*ii + jj] = column[ii];
+        };
+
+        // Generate samples, across the pool if enabled
+        if (threads < 2) {
+            if (method == LATIN_HYPERCUBE) {
+                samples = latin_hypercube<T>(n, dim, seed);
+            } else {
+                generate_block(0, n);
+            }
+        } else {
+            thames::util::threadpool::WorkStealingPool pool(threads);
+            if (method == LATIN_HYPERCUBE) {
+                for (std::size_t jj = 0; jj < dim; jj++)
+                    pool.submit([&generate_dimension, jj]() {generate_dimension(jj);});
+            } else {
+                const std::size_t blocksize = (n + threads - 1)/threads;
+                for (std::size_t start = 0; start < n; start += blocksize)
+                    pool.submit([&generate_block, start, blocksize, n]() {generate_block(start, std::min(start + blocksize, n));});
+            }
+            pool.wait();
+        }
+
+        // Scale samples to the bounds
+        for (std::size_t ii = 0; ii < n; ii++)
+            for (std::size_t jj = 0; jj < dim; jj++)
+                samples[dim*ii + jj] = lower[jj] + (upper[jj] - lower[jj])*samples[dim*ii + jj];
+
+        // Return samples
+        return samples;
+    }
+    template std::vector<double> generate_samples(const SamplingMethods, const std::size_t, const std::vector<double>&, const std::vector<double>&, const unsigned int, const unsigned int);
+    template std::vector<float> generate_samples(const SamplingMethods, const std::size_t, const std::vector<float>&, const std::vector<float>&, const unsigned int, const unsigned int);
+    template std::vector<long double> generate_samples(const SamplingMethods, const std::size_t, const std::vector<long double>&, const std::vector<long double>&, const unsigned int, const unsigned int);
 
 }
\ No newline at end of file
@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../include/util/statistics.h"
+#include "../../include/util/threadpool.h"
+
+namespace thames::util::statistics {
+
+    template<class T>
+    void ErrorAccumulator<T>::add(const std::vector<std::vector<T>>& states, const std::vector<std::vector<T>>& reference) {
+        // Check number of samples
+        if (states.size() != reference.size())
+            throw std::runtime_error("Inconsistent number of samples for error statistics");
+
+        // Iterate through samples
+        for (std::size_t ii = 0; ii < states.size(); ii++) {
+            // Check state sizes
+            const std::vector<T>& x = states[ii];
+            const std::vector<T>& xref = reference[ii];
+            if (x.size() != 6 || xref.size() != 6)
+                throw std::runtime_error("Error statistics require Cartesian states");
+
+            // Calculate position and velocity errors
+            T dr[3], dv[3];
+            for (std::size_t jj = 0; jj < 3; jj++) {
+                dr[jj] = x[jj] - xref[jj];
+                dv[jj] = x[3 + jj] - xref[3 + jj];
+            }
+            const T dr2 = dr[0]*dr[0] + dr[1]*dr[1] + dr[2]*dr[2];
+            const T dv2 = dv[0]*dv[0] + dv[1]*dv[1] + dv[2]*dv[2];
+
+            // Calculate RSW frame of the reference state
+            const T* R = xref.data();
+            const T* V = xref.data() + 3;
+            const T W[3] = {R[1]*V[2] - R[2]*V[1], R[2]*V[0] - R[0]*V[2], R[0]*V[1] - R[1]*V[0]};
+            const T S[3] = {W[1]*R[2] - W[2]*R[1], W[2]*R[0] - W[0]*R[2], W[0]*R[1] - W[1]*R[0]};
+            const T Rnorm = std::sqrt(R[0]*R[0] + R[1]*R[1] + R[2]*R[2]);
+            const T Wnorm = std::sqrt(W[0]*W[0] + W[1]*W[1] + W[2]*W[2]);
+            const T Snorm = std::sqrt(S[0]*S[0] + S[1]*S[1] + S[2]*S[2]);
+
+            // Project position error into the RSW frame
+            const T rsw[3] = {
+                (dr[0]*R[0] + dr[1]*R[1] + dr[2]*R[2])/Rnorm,
+                (dr[0]*S[0] + dr[1]*S[1] + dr[2]*S[2])/Snorm,
+                (dr[0]*W[0] + dr[1]*W[1] + dr[2]*W[2])/Wnorm
+            };
+
+            // Accumulate errors
+            m_nsamples++;
+            m_dr2 += dr2;
+            m_dv2 += dv2;
+            m_drMax = std::max(m_drMax, std::sqrt(dr2));
+            m_dvMax = std::max(m_dvMax, std::sqrt(dv2));
+            for (std::size_t jj = 0; jj < 3; jj++) {
+                m_rsw[jj] += rsw[jj];
+                m_rsw2[jj] += rsw[jj]*rsw[jj];
+            }
+        }
+    }
+
+    template<class T>
+    void ErrorAccumulator<T>::merge(const ErrorAccumulator<T>& other) {
+        // Combine sums and maxima
+        m_nsamples += other.m_nsamples;
+        m_dr2 += other.m_dr2;
+        m_dv2 += other.m_dv2;
+        m_drMax = std::max(m_drMax, other.m_drMax);
+        m_dvMax = std::max(m_dvMax, other.m_dvMax);
+        for (std::size_t jj = 0; jj < 3; jj++) {
+            m_rsw[jj] += other.m_rsw[jj];
+            m_rsw2[jj] += other.m_rsw2[jj];
+        }
+    }
+
+    template<class T>
+    ErrorStatistics<T> ErrorAccumulator<T>::statistics() const {
+        // Declare statistics
+        ErrorStatistics<T> statistics;
+        statistics.nsamples = m_nsamples;
+        if (m_nsamples == 0)
+            return statistics;
+
+        // Calculate root mean square and maximum errors
+        statistics.drRms = std::sqrt(m_dr2/m_nsamples);
+        statistics.dvRms = std::sqrt(m_dv2/m_nsamples);
+        statistics.drMax = m_drMax;
+        statistics.dvMax = m_dvMax;
+
+        // Calculate RSW errors, and the dominant direction of the mean error
+        for (std::size_t jj = 0; jj < 3; jj++) {
+            statistics.rswRms[jj] = std::sqrt(m_rsw2[jj]/m_nsamples);
+            statistics.rswMean[jj] = m_rsw[jj]/m_nsamples;
+            if (std::abs(statistics.rswMean[jj]) > std::abs(statistics.rswMean[statistics.rswDominant]))
+                statistics.rswDominant = jj;
+        }
+
+        // Return statistics
+        return statistics;
+    }
+
+    template class ErrorAccumulator<double>;
+    template class ErrorAccumulator<float>;
+    template class ErrorAccumulator<long double>;
+
+    template<class T>
+    ErrorStatistics<T> error_statistics(const std::vector<std::vector<T>>& states, const std::vector<std::vector<T>>& reference, const unsigned int threads) {
+        // Check number of samples
+        if (states.size() != reference.size())
+            throw std::runtime_error("Inconsistent number of samples for error statistics");
+
+        // Accumulate samples in turn
+        ErrorAccumulator<T> accumulator;
+        if (threads < 2) {
+            accumulator.add(states, reference);
+            return accumulator.statistics();
+        }
+
+        // Accumulate contiguous ranges of samples across the pool
+        const std::size_t blocksize = (states.size() + threads - 1)/threads;
+        std::vector<ErrorAccumulator<T>> accumulators((states.size() + blocksize - 1)/std::max<std::size_t>(blocksize, 1));
+        {
+            thames::util::threadpool::WorkStealingPool pool(threads);
+            for (std::size_t ii = 0; ii < accumulators.size(); ii++) {
+                pool.submit([&, ii]() {
+                    const std::size_t start = ii*blocksize, end = std::min(start + blocksize, states.size());
+                    const std::vector<std::vector<T>> block(states.begin() + start, states.begin() + end);
+                    const std::vector<std::vector<T>> block_reference(reference.begin() + start, reference.begin() + end);
+                    accumulators[ii].add(block, block_reference);
+                });
+            }
+            pool.wait();
+        }
+
+        // Combine accumulators in order
+        for (const ErrorAccumulator<T>& block : accumulators)
+            accumulator.merge(block);
+        return accumulator.statistics();
+    }
+    template ErrorStatistics<double> error_statistics(const std::vector<std::vector<double>>&, const std::vector<std::vector<double>>&, const unsigned int);
+    template ErrorStatistics<float> error_statistics(const std::vector<std::vector<float>>&, const std::vector<std::vector<float>>&, const unsigned int);
+    template ErrorStatistics<long double> error_statistics(const std::vector<std::vector<long double>>&, const std::vector<std::vector<long double>>&, const unsigned int);
+
+    std::string csv_header() {
+        return "nSamples,drRms,dvRms,drMax,dvMax,rswRRms,rswSRms,rswWRms,rswRMean,rswSMean,rswWMean,rswDominant";
+    }
+
+    template<class T>
+    std::string csv_row(const ErrorStatistics<T>& statistics) {
+        // Write values at full precision
+        std::ostringstream row;
+        row << std::setprecision(std::numeric_limits<T>::max_digits10);
+        row << statistics.nsamples << "," << statistics.drRms << "," << statistics.dvRms << "," << statistics.drMax << "," << statistics.dvMax;
+        for (const T value : statistics.rswRms)
+            row << "," << value;
+        for (const T value : statistics.rswMean)
+            row << "," << value;
+        row << "," << statistics.rswDominant;
+
+        // Return row
+        return row.str();
+    }
+    template std::string csv_row(const ErrorStatistics<double>&);
+    template std::string csv_row(const ErrorStatistics<float>&);
+    template std::string csv_row(const ErrorStatistics<long double>&);
+
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+/*
+MIT License
+
+Copyright (c) 2021-2022 Max Hallgarten La Casta
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../../include/util/threadpool.h"
+
+namespace thames::util::threadpool {
+
+    // Flag for whether the current thread is a worker of a pool
+    thread_local bool isWorker = false;
+
+    WorkStealingPool::WorkStealingPool(const unsigned int nthreads) {
+        // Select number of threads
+        const std::size_t n = (nthreads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : nthreads;
+
+        // Create queues
+        for(std::size_t ii=0; ii<n; ii++)
+            m_queues.push_back(std::make_unique<TaskQueue>());
+
+        // Start workers
+        for(std::size_t ii=0; ii<n; ii++)
+            m_threads.emplace_back(&WorkStealingPool::worker, this, ii);
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        // Signal workers to stop once the queues are empty
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_queuedCondition.notify_all();
+
+        // Join workers
+        for(std::thread& thread : m_threads)
+            thread.join();
+    }
+
+    void WorkStealingPool::submit(std::function<void()> task) {
+        // Select queue in turn, and update counters before the task can be taken
+        std::size_t index;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            index = m_next;
+            m_next = (m_next + 1) % m_queues.size();
+            m_queued++;
+            m_pending++;
+        }
+
+        // Queue task
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(task));
+        }
+
+        // Wake a worker
+        m_queuedCondition.notify_one();
+    }
+
+    void WorkStealingPool::wait() {
+        // Wait for pending tasks
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_completeCondition.wait(lock, [this]{ return m_pending == 0; });
+
+        // Rethrow first exception
+        if(m_exception){
+            std::exception_ptr exception = m_exception;
+            m_exception = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void WorkStealingPool::parallel_for(const std::size_t n, const std::function<void(const std::size_t)>& body) {
+        // Run in the calling thread if nested within a pool, or if there is nothing to share
+        const std::size_t nhelpers = std::min(size(), n) - ((n > 0) ? 1 : 0);
+        if(is_worker() || nhelpers == 0){
+            for(std::size_t ii=0; ii<n; ii++)
+                body(ii);
+            return;
+        }
+
+        // Declare state of the loop, shared with the helper tasks
+        struct Loop {
+            /// Index of the next unclaimed iteration
+            std::atomic<std::size_t> next{0};
+            /// Mutex guarding the helper counter and the exception
+            std::mutex mutex;
+            /// Condition variable to signal that the helpers are complete
+            std::condition_variable complete;
+            /// Number of incomplete helper tasks
+            std::size_t helpers = 0;
+            /// First exception raised by an iteration
+            std::exception_ptr exception;
+        };
+        auto loop = std::make_shared<Loop>();
+        loop->helpers = nhelpers;
+
+        // Claim and run iterations until none remain, storing the first exception
+        // NOTE: the body is captured by reference, as the calling thread waits for every helper before returning
+        auto run = [loop, &body, n]() {
+            for(std::size_t ii=loop->next++; ii<n; ii=loop->next++){
+                try {
+                    body(ii);
+                } catch(...) {
+                    std::lock_guard<std::mutex> lock(loop->mutex);
+                    if(!loop->exception)
+                        loop->exception = std::current_exception();
+                }
+            }
+        };
+
+        // Submit helpers
+        for(std::size_t ii=0; ii<nhelpers; ii++){
+            submit([loop, run]() {
+                run();
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                if(--loop->helpers == 0)
+                    loop->complete.notify_all();
+            });
+        }
+
+        // Take part in the loop, then wait for the helpers
+        run();
+        std::unique_lock<std::mutex> lock(loop->mutex);
+        loop->complete.wait(lock, [&loop]{ return loop->helpers == 0; });
+
+        // Rethrow first exception
+        if(loop->exception)
+            std::rethrow_exception(loop->exception);
+    }
+
+    std::size_t WorkStealingPool::size() const {
+        return m_threads.size();
+    }
+
+    WorkStealingPool& WorkStealingPool::shared() {
+        static WorkStealingPool pool;
+        return pool;
+    }
+
+    bool WorkStealingPool::is_worker() {
+        return isWorker;
+    }
+
+    bool WorkStealingPool::pop(const std::size_t index, std::function<void()>& task) {
+        // Take newest task from own queue
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            if(!m_queues[index]->tasks.empty()){
+                task = std::move(m_queues[index]->tasks.back());
+                m_queues[index]->tasks.pop_back();
+                return true;
+            }
+        }
+
+        // Steal oldest task from other queues
+        for(std::size_t ii=1; ii<m_queues.size(); ii++){
+            TaskQueue& queue = *m_queues[(index + ii) % m_queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(!queue.tasks.empty()){
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void WorkStealingPool::worker(const std::size_t index) {
+        // Flag thread as a worker
+        isWorker = true;
+
+        while(true){
+            // Find task
+            std::function<void()> task;
+            if(!pop(index, task)){
+                // Wait for tasks to be queued, or for the pool to stop
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_queuedCondition.wait(lock, [this]{ return m_stop || m_queued > 0; });
+                if(m_stop && m_queued == 0)
+                    return;
+                continue;
+            }
+
+            // Update queued counter
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queued--;
+            }
+
+            // Run task, storing the first exception
+            try {
+                task();
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(!m_exception)
+                    m_exception = std::current_exception();
+            }
+
+            // Update pending counter and signal completion
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_pending--;
+                if(m_pending == 0)
+                    m_completeCondition.notify_all();
+            }
+        }
+    }
+
+}
\ No newline at end of file
@@ -47,6 +47,8 @@ namespace thames::vector::arithmeticoverloads {
         return c;
     }
     template std::vector<double> operator+<double>(const std::vector<double>& a, const std::vector<double>& b);
+    template std::vector<float> operator+<float>(const std::vector<float>& a, const std::vector<float>& b);
+    template std::vector<long double> operator+<long double>(const std::vector<long double>& a, const std::vector<long double>& b);
 
     template<class T>
     std::vector<T> operator-(const std::vector<T>& a, const std::vector<T>& b){
@@ -58,6 +60,8 @@ namespace thames::vector::arithmeticoverloads {
         return c;
     }
     template std::vector<double> operator-<double>(const std::vector<double>& a, const std::vector<double>& b);
+    template std::vector<float> operator-<float>(const std::vector<float>& a, const std::vector<float>& b);
+    template std::vector<long double> operator-<long double>(const std::vector<long double>& a, const std::vector<long double>& b);
 
     template<class T>
     std::vector<T> operator*(const T& a, const std::vector<T>& b){
@@ -69,12 +73,16 @@ namespace thames::vector::arithmeticoverloads {
         return c;
     }
     template std::vector<double> operator*<double>(const double& a, const std::vector<double>& b);
+    template std::vector<float> operator*<float>(const float& a, const std::vector<float>& b);
+    template std::vector<long double> operator*<long double>(const long double& a, const std::vector<long double>& b);
 
     template<class T>
     std::vector<T> operator*(const std::vector<T>& b, const T& a){
         return a*b;
     }
     template std::vector<double> operator*<double>(const std::vector<double>& b, const double& a);
+    template std::vector<float> operator*<float>(const std::vector<float>& b, const float& a);
+    template std::vector<long double> operator*<long double>(const std::vector<long double>& b, const long double& a);
 
     template<class T>
     std::vector<T> operator/(const std::vector<T>& b, const T& a){
@@ -86,6 +94,8 @@ namespace thames::vector::arithmeticoverloads {
         return c;
     }
     template std::vector<double> operator/<double>(const std::vector<double>& b, const double& a);
+    template std::vector<float> operator/<float>(const std::vector<float>& b, const float& a);
+    template std::vector<long double> operator/<long double>(const std::vector<long double>& b, const long double& a);
 
     /////////////////
     // Polynomials //
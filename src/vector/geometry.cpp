@@ -43,6 +43,8 @@ namespace thames::vector::geometry{
         return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
     }
     template double dot3<double>(const std::vector<double>&, const std::vector<double>&);
+    template float dot3<float>(const std::vector<float>&, const std::vector<float>&);
+    template long double dot3<long double>(const std::vector<long double>&, const std::vector<long double>&);
 
     template<class T>
     T norm3(const std::vector<T>& a){
@@ -50,6 +52,8 @@ namespace thames::vector::geometry{
         return sqrt(dot3<T>(a, a));
     }
     template double norm3<double>(const std::vector<double>&);
+    template float norm3<float>(const std::vector<float>&);
+    template long double norm3<long double>(const std::vector<long double>&);
 
     template<class T>
     void cross3(const std::vector<T>& a, const std::vector<T>& b, std::vector<T>& vecout){
@@ -59,6 +63,8 @@ namespace thames::vector::geometry{
         vecout[2] = a[0]*b[1] - a[1]*b[0];
     }
     template void cross3<double>(const std::vector<double>&, const std::vector<double>&, std::vector<double>&);
+    template void cross3<float>(const std::vector<float>&, const std::vector<float>&, std::vector<float>&);
+    template void cross3<long double>(const std::vector<long double>&, const std::vector<long double>&, std::vector<long double>&);
 
     template<class T>
     std::vector<T> cross3(const std::vector<T>& a, const std::vector<T>& b){
@@ -72,6 +78,8 @@ namespace thames::vector::geometry{
         return vecout;
     }
     template std::vector<double> cross3<double>(const std::vector<double>&, const std::vector<double>&);
+    template std::vector<float> cross3<float>(const std::vector<float>&, const std::vector<float>&);
+    template std::vector<long double> cross3<long double>(const std::vector<long double>&, const std::vector<long double>&);
 
     /////////////////
     // Polynomials //